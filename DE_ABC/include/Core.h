@@ -4,6 +4,17 @@
 #include "Instance.h"
 #include "Solution.h"
 
+#include <ostream>
+#include <string>
+#include <vector>
+
+// With -Ddispatch the hot kernels are compiled once per ISA and the dynamic loader picks the best one for the CPU
+#if defined(BFSP_DISPATCH) && defined(__x86_64__) && defined(__ELF__)
+#define BFSP_KERNEL __attribute__((target_clones("default", "sse4.2", "avx2", "avx512f")))
+#else
+#define BFSP_KERNEL
+#endif
+
 namespace core {
 
 void calculate_departure_times(Instance &instance, Solution &s);
@@ -21,6 +32,55 @@ void partial_recalculate_solution(Instance &instance, Solution &s, size_t start)
 
 void recalculate_solution(Instance &instance, Solution &s);
 
+// Makespan alone from a single rolling departure row, for callers that only need the cost
+size_t calculate_makespan(Instance &instance, const std::vector<size_t> &sequence);
+
+// Sets only s.cost and drops the departure times s held, partial_recalculate_solution rebuilds them in full the first
+// time they are needed
+void calculate_cost(Instance &instance, Solution &s);
+
+// Makespan evaluations done so far. A full or partial recalculation counts as one, a best insertion scan counts one
+// per position tried
+size_t evaluations();
+
+void count_evaluations(size_t amount = 1);
+
+void set_evaluation_budget(size_t budget);
+
+// Makespan to reach (--target), the run stops right after the solution reaching it is accepted
+void set_target(size_t target);
+
+// Whether the main loop must stop: once the target was reached by best_cost, otherwise when the evaluation budget
+// (--evaluations) is spent or, without one, when time_is_up
+bool should_stop(bool time_is_up, size_t best_cost);
+
+// Whether the evaluation budget is spent, for checks inside a long step of the main loop. Unlike should_stop it leaves
+// the target alone, so the main loop still gets its pass after the target is reached
+bool budget_spent();
+
+// Print the evaluations per second and the time to target to os, each only if its mode is enabled
+void report_evaluations(std::ostream &os);
+
+void report_target(std::ostream &os);
+
+// Instruction set the BFSP_KERNEL functions run with (--print-isa)
+const char *selected_isa();
+
+// Metadata written with the convergence trace so it can be analysed without the command that produced it
+struct RunInfo {
+    std::string algorithm;
+    std::string instance;
+    size_t seed;
+    std::vector<std::string> arguments;
+};
+
+// Record every improvement of the best cost seen by should_stop as (elapsed ns, evaluations, cost) (--trace)
+void enable_trace(std::string path, RunInfo info);
+
+// Write the trace as JSON if the path ends in .json, CSV otherwise. final_cost is recorded first since the solution
+// returned may have improved after the last check
+void write_trace(size_t final_cost);
+
 } // namespace core
 
 #endif // !CORE_H
@@ -3,6 +3,7 @@
 #include "Instance.h"
 #include "Parameters.h"
 #include "Solution.h"
+#include "constructions/TransitionMatrix.h"
 
 class MinMax {
   public:
@@ -11,8 +12,9 @@ class MinMax {
     Solution solve();
 
   private:
-    Instance m_instance;
+    Instance &m_instance;
     double m_alpha;
+    TransitionMatrix m_transition;
 };
 
 #endif
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <limits>
 
+#include "Stats.h"
+
 namespace {
 size_t uptime() {
     static const auto global_start_time = std::chrono::steady_clock::now();
@@ -52,6 +54,7 @@ bool DE_ABC::new_in_population(std::vector<size_t> &sequence) {
 }
 
 void DE_ABC::generate_initial_pop() {
+    STATS_TIME(Initial);
 
     m_pop = std::vector<Solution>(1);
     MinMax mm = MinMax(m_instance, m_params.theta());
@@ -72,7 +75,7 @@ void DE_ABC::generate_initial_pop() {
 
         Solution s;
         s.sequence = new_seq;
-        core::recalculate_solution(m_instance, s);
+        core::calculate_cost(m_instance, s);
         m_pop.push_back(std::move(s));
     }
 }
@@ -93,6 +96,7 @@ size_t DE_ABC::tournament() {
 }
 
 void DE_ABC::mutation(std::vector<size_t> &new_pi) {
+    STATS_TIME(Mutation);
     const size_t n = m_instance.num_jobs();
 
     // taking three random solutions
@@ -121,6 +125,7 @@ void DE_ABC::mutation(std::vector<size_t> &new_pi) {
 }
 
 Solution DE_ABC::crossover(std::vector<size_t> &pi) {
+    STATS_TIME(Crossover);
     const size_t n = m_instance.num_jobs();
     std::vector<size_t> pi_temp;
 
@@ -225,6 +230,7 @@ size_t DE_ABC::insertion(Solution &s) {
 }
 
 void DE_ABC::self_adaptative() {
+    STATS_TIME(Mutation);
     size_t idx = 0;
     size_t idx_to_recalculate = 0;
     for (size_t i = 0; i < m_params.ps(); i++) {
@@ -261,6 +267,7 @@ void DE_ABC::self_adaptative() {
 }
 
 void DE_ABC::replace_worst_solution(Solution &s) {
+    STATS_TIME(Selection);
 
     // find the worst solution
     size_t worst = 0;
@@ -288,9 +295,15 @@ size_t DE_ABC::find_best_solution() {
 }
 
 void DE_ABC::local_search() {
+    STATS_TIME(LocalSearch);
     size_t idx = 0;
 
     for (size_t i = 0; i < m_instance.num_jobs(); i++) {
+        // One rls per job is most of a generation, so the budget is also checked here and not only in solve()
+        if (core::budget_spent()) {
+            return;
+        }
+
         if (RNG::instance().generate_real_number(0, 1) < m_params.pls()) {
             idx = tournament();
             if (rls(m_pop[idx], m_instance)) {
@@ -306,6 +319,7 @@ void DE_ABC::local_search() {
 }
 
 void DE_ABC::replace_unchanged() {
+    STATS_TIME(Shaking);
 
     size_t idx_to_recalculate = std::numeric_limits<size_t>::max();
     size_t idx;
@@ -346,6 +360,7 @@ Solution DE_ABC::solve() {
     best_solution = m_pop[idx];
 
     while (true) {
+        STATS_COUNT(Iteration);
 
         Solution s = generate_new_solution();
         
@@ -363,7 +378,7 @@ Solution DE_ABC::solve() {
             ro.pop_back();
         }
 
-        if (uptime() > m_time_limit) {
+        if (core::should_stop(uptime() > m_time_limit, std::min(best_solution.cost, m_pop[idx].cost))) {
             break;
         }
 
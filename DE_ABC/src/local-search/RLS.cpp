@@ -2,6 +2,7 @@
 #include "Core.h"
 #include "Instance.h"
 #include "Solution.h"
+#include "Stats.h"
 #include "constructions/NEH.h"
 
 #include <cassert>
@@ -142,6 +143,7 @@ std::vector<std::pair<size_t, size_t>> grabowski_reinsertion(const Instance &ins
 } // namespace
 
 bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    STATS_COUNT(RlsCall);
     bool improved = false;
     size_t j = 0;
     size_t cnt = 0;
@@ -149,6 +151,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
     core::recalculate_solution(instance, s); // Set departure times matrix
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
 
@@ -168,6 +171,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
         if (makespan < s.cost) {
             s.sequence.insert(s.sequence.begin() + (long)best_index, job);
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             core::partial_recalculate_solution(instance, s, std::min(og_index, best_index));
@@ -183,12 +187,14 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
 }
 
 bool rls(Solution &s, Instance &instance) {
+    STATS_COUNT(RlsCall);
 
     bool improved = false;
     size_t cnt = 0;
     NEH helper(instance);
     std::vector<size_t> ref = s.sequence;
     while (cnt < instance.num_jobs()) {
+        STATS_COUNT(RlsStep);
         
         const size_t job = ref[cnt];
         for (size_t i = 0; i < s.sequence.size(); i++) {
@@ -202,6 +208,7 @@ bool rls(Solution &s, Instance &instance) {
         s.sequence.insert(s.sequence.begin() + (long)best_index, job);
 
         if (makespan < s.cost) {
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
         }
@@ -3,10 +3,12 @@
 #include <iostream>
 #include <numeric>
 
+#include "Core.h"
 #include "DE_ABC.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -17,12 +19,34 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"DE_ABC", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
     // std::cout << "Seed: " << RNG::instance().seed() << '\n';
 
+    const bool print_stats = params.stats();
+
     DE_ABC deabc = DE_ABC(std::move(instance), params);
     const Solution s = deabc.solve();
 
     std::cout << s.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(s.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 
     return 0;
 }
@@ -0,0 +1,114 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <ostream>
+
+// Hot-path counters and per-phase timers, printed by --stats. Everything below compiles to nothing unless the
+// project is configured with -Dstats=true, which defines BFSP_STATS
+
+// clang-format off
+#define STATS_COUNTERS(X)                                                                                              \
+    X(Iteration, "iterations")                                                                                         \
+    X(BestInsertion, "best insertion scans")                                                                           \
+    X(InsertCalculation, "insertion evaluations")                                                                      \
+    X(InsertEarlyExit, "insertion early exits")                                                                        \
+    X(RlsCall, "rls calls")                                                                                            \
+    X(RlsStep, "rls reinsertions")                                                                                     \
+    X(RlsImprovement, "rls improvements")
+
+#define STATS_PHASES(X)                                                                                                \
+    X(Initial, "initial solution")                                                                                     \
+    X(Mutation, "mutation")                                                                                            \
+    X(Crossover, "crossover")                                                                                          \
+    X(Shaking, "shaking")                                                                                              \
+    X(Destruction, "destruction")                                                                                      \
+    X(Construction, "construction")                                                                                    \
+    X(LocalSearch, "local search")                                                                                     \
+    X(Acceptance, "acceptance")                                                                                        \
+    X(Selection, "selection")
+// clang-format on
+
+#ifdef BFSP_STATS
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+
+namespace stats {
+
+#define STATS_ENUM(name, label) name,
+enum class Counter : std::uint8_t { STATS_COUNTERS(STATS_ENUM) Count };
+enum class Phase : std::uint8_t { STATS_PHASES(STATS_ENUM) Count };
+#undef STATS_ENUM
+
+// Relaxed atomics, the counters are also hit from the parallel constructions
+inline std::array<std::atomic<std::uint64_t>, (size_t)Counter::Count> counters{};
+inline std::array<std::atomic<std::uint64_t>, (size_t)Phase::Count> phase_ns{};
+
+inline void add(Counter c, std::uint64_t value = 1) { counters[(size_t)c].fetch_add(value, std::memory_order_relaxed); }
+
+// Adds the lifetime of the object to the given phase
+class ScopedTimer {
+  public:
+    explicit ScopedTimer(Phase phase) : m_phase(phase), m_start(std::chrono::steady_clock::now()) {}
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+    ScopedTimer(ScopedTimer &&) = delete;
+    ScopedTimer &operator=(ScopedTimer &&) = delete;
+    ~ScopedTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        phase_ns[(size_t)m_phase].fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                                            std::memory_order_relaxed);
+    }
+
+  private:
+    Phase m_phase;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// Only the counters and phases that were hit are printed
+inline void print(std::ostream &os) {
+    std::uint64_t total_ns = 0;
+    for (const auto &ns : phase_ns) {
+        total_ns += ns.load();
+    }
+
+    os << "counters:\n";
+#define STATS_PRINT_COUNTER(name, label)                                                                               \
+    if (auto value = counters[(size_t)Counter::name].load()) {                                                         \
+        os << "  " << std::left << std::setw(24) << label << std::right << std::setw(16) << value << '\n';             \
+    }
+    STATS_COUNTERS(STATS_PRINT_COUNTER)
+#undef STATS_PRINT_COUNTER
+
+    os << "phases (ms, share of timed):\n";
+#define STATS_PRINT_PHASE(name, label)                                                                                 \
+    if (auto ns = phase_ns[(size_t)Phase::name].load()) {                                                              \
+        os << "  " << std::left << std::setw(24) << label << std::right << std::fixed << std::setprecision(1)          \
+           << std::setw(16) << (double)ns / 1e6 << std::setw(8) << 100.0 * (double)ns / (double)total_ns << "%\n";     \
+    }
+    STATS_PHASES(STATS_PRINT_PHASE)
+#undef STATS_PRINT_PHASE
+}
+
+} // namespace stats
+
+#define STATS_COUNT(counter) stats::add(stats::Counter::counter)
+#define STATS_CONCAT_INNER(a, b) a##b
+#define STATS_CONCAT(a, b) STATS_CONCAT_INNER(a, b)
+#define STATS_TIME(phase) const stats::ScopedTimer STATS_CONCAT(stats_timer_, __LINE__)(stats::Phase::phase)
+
+#else
+
+namespace stats {
+inline void print(std::ostream &os) { os << "stats: not compiled in, configure with -Dstats=true\n"; }
+} // namespace stats
+
+#define STATS_COUNT(counter) ((void)0)
+#define STATS_TIME(phase) ((void)0)
+
+#endif
+
+#endif
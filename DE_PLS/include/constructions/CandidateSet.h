@@ -0,0 +1,44 @@
+#ifndef CANDIDATE_SET_H
+#define CANDIDATE_SET_H
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// Set of unscheduled jobs used by the constructive heuristics. Every job keeps its position on the list so removing
+// the chosen candidate is a swap with the last one instead of shifting the whole list. Because of that the iteration
+// order is not sorted, heuristics that break ties by the job index must compare it explicitly
+class CandidateSet {
+  public:
+    CandidateSet(size_t num_jobs) : m_position(num_jobs, NOT_PRESENT) { m_jobs.reserve(num_jobs); }
+
+    void insert(size_t job) {
+        m_position[job] = m_jobs.size();
+        m_jobs.push_back(job);
+    }
+
+    void erase(size_t job) {
+        const size_t pos = m_position[job];
+
+        m_jobs[pos] = m_jobs.back();
+        m_position[m_jobs[pos]] = pos;
+        m_jobs.pop_back();
+        m_position[job] = NOT_PRESENT;
+    }
+
+    bool contains(size_t job) const { return m_position[job] != NOT_PRESENT; }
+    bool empty() const { return m_jobs.empty(); }
+    size_t size() const { return m_jobs.size(); }
+    size_t front() const { return m_jobs.front(); }
+
+    std::vector<size_t>::const_iterator begin() const { return m_jobs.begin(); }
+    std::vector<size_t>::const_iterator end() const { return m_jobs.end(); }
+
+  private:
+    static constexpr size_t NOT_PRESENT = std::numeric_limits<size_t>::max();
+
+    std::vector<size_t> m_jobs;
+    std::vector<size_t> m_position;
+};
+
+#endif
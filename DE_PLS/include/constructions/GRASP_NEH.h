@@ -3,6 +3,8 @@
 
 #include "Instance.h"
 #include "Solution.h"
+#include <atomic>
+#include <random>
 
 class GRASP_NEH {
   public:
@@ -10,9 +12,16 @@ class GRASP_NEH {
 
     Solution solve();
 
-    Solution GRASP();
+    // Runs `starts` GRASP-NEH constructions in parallel and returns the best one. Each start gets its own generator
+    // seeded from RNG beforehand, so a fixed seed still gives the same result
+    Solution multi_start(size_t starts);
+
+    Solution GRASP(std::mt19937 &gen);
 
   private:
+    // Returns false if the NEH phase was abandoned for going over upper_bound
+    bool construct(std::mt19937 &gen, Solution &s, const std::atomic<size_t> &upper_bound);
+
     Instance &m_instance;
     size_t m_x;
     double m_beta;
@@ -2,7 +2,9 @@
 #define NEH_H
 
 #include "Instance.h"
+#include "Parallel.h"
 #include "Solution.h"
+#include <atomic>
 
 class NEH {
   public:
@@ -20,11 +22,18 @@ class NEH {
     std::pair<size_t, size_t> taillard_grabowski_best_ins(const Solution &s, size_t k,
                                                           const std::vector<std::pair<size_t, size_t>> &ranges);
 
-    void second_step(std::vector<size_t> phi, Solution &s);
+    void second_step(const std::vector<size_t> &phi, Solution &s);
+
+    // Same as above but gives up once the partial makespan goes over upper_bound, inserting more jobs can never lower
+    // it. Returns false if the solution was abandoned
+    bool second_step(const std::vector<size_t> &phi, Solution &s, const std::atomic<size_t> &upper_bound);
 
   private:
     size_t insert_calculation(size_t i, size_t k, size_t best_value);
 
+    // Positions 1..size of taillard_best_insertion split among the workers of pool, with the same result
+    std::pair<size_t, size_t> parallel_insertion_scan(WorkerPool &pool, size_t k, size_t size, size_t best_value);
+
     Instance &m_instance;
 
     // TaillarDS (TDS) matrices
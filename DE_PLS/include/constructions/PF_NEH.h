@@ -10,7 +10,14 @@ class PF_NEH { // NOLINT
 
     Solution solve(size_t lambda, size_t stpt_index = 0);
 
+    // Runs solve() for the first `starts` STPT jobs in parallel and returns the best one, starts that can no longer beat
+    // the best finished so far are abandoned. The result is the same as running them one after another
+    Solution multi_start(size_t lambda, size_t starts);
+
   private:
+    // Builds the PF part of the solution into s and returns the jobs left for NEH
+    std::vector<size_t> pf_phase(size_t lambda, size_t stpt_index, Solution &s);
+
     Instance &m_instance;
 };
 
@@ -3,6 +3,7 @@
 #include "Core.h"
 #include "Log.h"
 #include "RNG.h"
+#include "Stats.h"
 #include "constructions/GRASP_NEH.h"
 #include "constructions/PF_NEH.h"
 #include "local-search/RLS.h"
@@ -56,6 +57,7 @@ bool DE_PLS::equal_solution(Solution &s1, Solution &s2) {
 }
 
 void DE_PLS::initialize_population() {
+    STATS_TIME(Initial);
 
     PF_NEH pf_neh(m_instance);
     NEH neh(m_instance);
@@ -63,23 +65,11 @@ void DE_PLS::initialize_population() {
 
     m_pop = std::vector<Solution>(m_params.np());
 
-    // taking the first solution using PF-NEH
-    // i think pf-neh is deterministic, so this loop is useless
-    for (size_t i = 0; i < m_params.x(); i++) {
-        const Solution pi = pf_neh.solve(m_params.delta(), i);
-        if (pi.cost < m_pop[0].cost) {
-            m_pop[0] = pi;
-        }
-    }
+    // taking the first solution using PF-NEH, every start uses a different STPT job
+    m_pop[0] = pf_neh.multi_start(m_params.delta(), m_params.x());
 
     // taking the second solution using GRASP-NEH
-    for (size_t i = 0; i < m_params.x(); i++) {
-        const Solution pi = grasp_neh.solve();
-        if (pi.cost < m_pop[1].cost) {
-            m_pop[1] = pi;
-        }
-    }
-    core::recalculate_solution(m_instance, m_pop[1]);
+    m_pop[1] = grasp_neh.multi_start(m_params.x());
 
     for (size_t i = 2; i < m_params.np(); i++) {
         const std::vector<size_t> phi = generate_random_sequence();
@@ -170,6 +160,7 @@ void DE_PLS::update_params(Solution &s, std::vector<double> &x) {
 }
 
 void DE_PLS::perturbation(Solution &s) {
+    STATS_TIME(Construction);
 
     std::vector<size_t> jobs(s.ps);
     for (size_t i = 0; i < s.ps; i++) {
@@ -185,6 +176,7 @@ void DE_PLS::perturbation(Solution &s) {
 }
 
 void DE_PLS::desconstruct_construct(Solution &s) {
+    STATS_TIME(Construction);
 
     std::vector<size_t> jobs(s.ds);
     for (size_t i = 0; i < s.ds; i++) {
@@ -214,14 +206,18 @@ Solution DE_PLS::solve() {
     std::vector<size_t> ref = best_solution.sequence;
     
     while (true) {
+        STATS_COUNT(Iteration);
 
         for (size_t i = 0; i < m_params.np(); i++) {
 
             Solution s = m_pop[i];
 
-            std::vector<double> x = get_mutant();
-            get_trial(x);
-            update_params(s, x);
+            {
+                STATS_TIME(Mutation);
+                std::vector<double> x = get_mutant();
+                get_trial(x);
+                update_params(s, x);
+            }
 
             if (RNG::instance().generate_real_number(0, 1) < s.jp) {
                 perturbation(s);
@@ -231,18 +227,22 @@ Solution DE_PLS::solve() {
 
             core::recalculate_solution(m_instance, s);
 
-            rls(s, ref, m_instance);
-            core::recalculate_solution(m_instance, s);
+            {
+                STATS_TIME(LocalSearch);
+                rls(s, ref, m_instance);
+                core::recalculate_solution(m_instance, s);
+            }
 
             if (!ro.empty() && uptime() >= (ro.back() * mxn)) {
                 std::cout << best_solution.cost << '\n';
                 ro.pop_back();
             }
 
-            if (uptime() > m_time_limit) {
+            if (core::should_stop(uptime() > m_time_limit, std::min(best_solution.cost, s.cost))) {
                 break;
             }
 
+            STATS_TIME(Acceptance);
             if (s.cost <= m_pop[i].cost) {
                 m_pop[i] = s;
                 if (s.cost < best_solution.cost) {
@@ -263,7 +263,7 @@ Solution DE_PLS::solve() {
             ro.pop_back();
         }
 
-        if (uptime() > m_time_limit) {
+        if (core::should_stop(uptime() > m_time_limit, best_solution.cost)) {
             break;
         }
     }
@@ -1,34 +1,77 @@
 #include "constructions/GRASP_NEH.h"
 #include "Core.h"
+#include "Parallel.h"
 #include "RNG.h"
 #include "constructions/NEH.h"
 #include <iostream>
 
 #include <bits/types/cookie_io_functions_t.h>
 #include <cassert>
+#include <limits>
 #include <numeric>
 
 GRASP_NEH::GRASP_NEH(Instance &instance, size_t x, double beta) : m_instance(instance), m_x(x), m_beta(beta) {}
 
-Solution GRASP_NEH::solve() {
-    Solution pi_h = GRASP();
+bool GRASP_NEH::construct(std::mt19937 &gen, Solution &s, const std::atomic<size_t> &upper_bound) {
+    s = GRASP(gen);
 
-    const std::vector<size_t> phi = {pi_h.sequence.begin() + m_x, pi_h.sequence.end()};
+    std::vector<size_t> phi = {s.sequence.begin() + m_x, s.sequence.end()};
 
-    pi_h.sequence.erase(pi_h.sequence.begin() + m_x, pi_h.sequence.end());
+    s.sequence.erase(s.sequence.begin() + m_x, s.sequence.end());
 
     NEH helper(m_instance);
 
-    helper.second_step(phi, pi_h);
+    return helper.second_step(phi, s, upper_bound);
+}
+
+Solution GRASP_NEH::solve() {
+    const std::atomic<size_t> no_bound{std::numeric_limits<size_t>::max()};
+
+    Solution pi_h;
+    construct(RNG::instance().gen(), pi_h, no_bound);
 
     core::recalculate_solution(m_instance, pi_h);
 
     return pi_h;
 }
 
-Solution GRASP_NEH::GRASP() {
+Solution GRASP_NEH::multi_start(size_t starts) {
+
+    // Seeds are drawn serially so the shared RNG is never touched by the workers
+    std::vector<std::mt19937::result_type> seeds(starts);
+    for (auto &seed : seeds) {
+        seed = RNG::instance().gen()();
+    }
+
+    std::vector<Solution> results(starts);
+    std::vector<char> finished(starts, false); // not vector<bool>, workers write to different elements
+    std::atomic<size_t> best_cost{std::numeric_limits<size_t>::max()};
+
+    parallel_for(starts, [&](size_t i) {
+        std::mt19937 gen(seeds[i]);
+
+        if (construct(gen, results[i], best_cost)) {
+            finished[i] = true;
+            atomic_min(best_cost, results[i].cost);
+        }
+    });
+
+    // Ties go to the lowest start, a start is only abandoned when strictly worse so this one always finishes
+    size_t best = starts;
+    for (size_t i = 0; i < starts; i++) {
+        if (finished[i] && (best == starts || results[i].cost < results[best].cost)) {
+            best = i;
+        }
+    }
+
+    core::recalculate_solution(m_instance, results[best]);
+
+    return results[best];
+}
+
+Solution GRASP_NEH::GRASP(std::mt19937 &gen) {
     Solution s;
-    std::vector<size_t> dp(m_instance.num_machines(), 0);
+    s.sequence.reserve(m_instance.num_jobs());
     auto jobs = core::stpt_sort(m_instance);
 
     std::vector<bool> b_s(m_instance.num_jobs(), false);
@@ -36,11 +79,24 @@ Solution GRASP_NEH::GRASP() {
     s.sequence.push_back(jobs[0]);
     b_s[0] = true;
 
+    // Scoring a candidate only needs the departure times of the last job of s, so that row is kept instead of
+    // recalculating the whole partial sequence on every step
+    const size_t m = m_instance.num_machines();
+    std::vector<size_t> last_departure(m);
+    std::vector<size_t> dp(m, 0);
+
+    last_departure[0] = m_instance.p(jobs[0], 0);
+    for (size_t j = 1; j < m; j++) {
+        last_departure[j] = last_departure[j - 1] + m_instance.p(jobs[0], j);
+    }
+
+    std::vector<size_t> rcl;
+    rcl.reserve(m_instance.num_jobs());
+    std::vector<size_t> c(m_instance.num_jobs());
+
     for (size_t i = 1; i < m_instance.num_jobs(); i++) {
-        core::recalculate_solution(m_instance, s);
-        std::vector<size_t> rcl;
+        rcl.clear();
 
-        std::vector<size_t> c(m_instance.num_jobs());
         size_t c_min = std::numeric_limits<size_t>::max();
         size_t c_max = 0;
         for (size_t j = 0; j < m_instance.num_jobs(); j++) {
@@ -48,8 +104,7 @@ Solution GRASP_NEH::GRASP() {
                 continue;
             }
 
-            core::calculate_new_departure_time(m_instance, s.departure_times, dp, jobs[j]);
-            c[j] = core::calculate_sigma(m_instance, s.departure_times, dp, jobs[j]);
+            c[j] = core::calculate_append_sigma(m_instance, last_departure, dp, jobs[j]);
             c_max = std::max(c[j], c_max);
             c_min = std::min(c[j], c_min);
         }
@@ -66,10 +121,16 @@ Solution GRASP_NEH::GRASP() {
             }
         }
 
-        const size_t idx = RNG::instance().generate((size_t)0, rcl.size() - 1);
+        std::uniform_int_distribution<size_t> dis(0, rcl.size() - 1);
+        const size_t idx = dis(gen);
         s.sequence.push_back(jobs[rcl[idx]]);
         b_s[rcl[idx]] = true;
+
+        core::calculate_append_sigma(m_instance, last_departure, dp, jobs[rcl[idx]]);
+        last_departure.swap(dp);
     }
 
+    core::recalculate_solution(m_instance, s);
+
     return s;
 }
@@ -1,8 +1,10 @@
 #include "constructions/PF.h"
 #include "Core.h"
+#include "constructions/CandidateSet.h"
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <vector>
 
 PF::PF(Instance &instance) : m_instance(instance) {}
@@ -27,18 +29,17 @@ Solution PF::solve() {
 
 void PF::pf_insertion_phase(Solution &s, size_t first_job) {
     const size_t n = m_instance.num_jobs();     // número de jobs
+    const size_t m = m_instance.num_machines();
 
-    // selects job with smallest total processing time to be the first one
-    std::vector<bool> scheduled(n, false);
     std::vector<size_t> new_seq;
-    std::vector<size_t> unscheduled;
+    new_seq.reserve(n);
     new_seq.push_back(first_job);
-    scheduled[first_job] = true;
 
     // selecting unscheduled jobs, i.e. all jobs besides the first one
+    CandidateSet unscheduled(n);
     for (size_t i = 0; i < n; ++i) {
-        if (!scheduled[i]) {
-            unscheduled.push_back(i);
+        if (i != first_job) {
+            unscheduled.insert(i);
         }
     }
 
@@ -49,34 +50,35 @@ void PF::pf_insertion_phase(Solution &s, size_t first_job) {
     // sigma(j,k) represents the sum of idle and blocking times from adding job j to position k+1
     // after computing sigma for all jobs in the unscheduled vector
     // add the job with the lowest sigma to the main sequence
-    Solution s_current;
-    s_current.sequence = new_seq;
-    Solution s_candidate;
+    // Appending a job only depends on the departure times of the last scheduled one, so that row is all that is kept
+    std::vector<size_t> last_departure(m);
+    std::vector<size_t> candidate_departure(m);
+    std::vector<size_t> best_departure(m);
+
+    last_departure[0] = m_instance.p(first_job, 0);
+    for (size_t j = 1; j < m; j++) {
+        last_departure[j] = last_departure[j - 1] + m_instance.p(first_job, j);
+    }
+
     for (size_t k = 1; k < n - 1; ++k) {
 
-        core::recalculate_solution(m_instance, s_current);
         size_t best_sigma = std::numeric_limits<size_t>::max();
         size_t best_job = unscheduled.front();
 
         for (const size_t candidate : unscheduled) {
-            std::vector<size_t> candidate_sequence = new_seq;
-            candidate_sequence.push_back(candidate);
-            s_candidate.sequence = candidate_sequence;
-
-            core::recalculate_solution(m_instance, s_candidate);
-            std::vector<size_t> &d_new = s_candidate.departure_times.back();
-
             // computing sigma(j,k) criterium
-            const size_t sigma = core::calculate_sigma(m_instance, s_current.departure_times, d_new, candidate);
-            if (sigma < best_sigma) {
+            const size_t sigma = core::calculate_append_sigma(m_instance, last_departure, candidate_departure, candidate);
+            // The set is unordered, ties go to the smallest job as they would on a sorted list
+            if (sigma < best_sigma || (sigma == best_sigma && candidate < best_job)) {
                 best_sigma = sigma;
                 best_job = candidate;
+                best_departure.swap(candidate_departure);
             }
         }
 
         new_seq.push_back(best_job);
-        scheduled[best_job] = true;
-        unscheduled.erase(std::remove(unscheduled.begin(), unscheduled.end(), best_job), unscheduled.end());
+        unscheduled.erase(best_job);
+        last_departure.swap(best_departure);
     }
     new_seq.push_back(unscheduled.front());
 
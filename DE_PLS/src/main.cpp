@@ -10,6 +10,7 @@
 #include "Parameters.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -20,8 +21,28 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"DE_PLS", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
     DE_PLS depls(std::move(instance), params);
     const Solution s = depls.solve();
 
     std::cout << s.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(s.cost);
+
+    if (params.stats()) {
+        stats::print(std::cerr);
+    }
 }
@@ -1,7 +1,9 @@
 #ifndef INSTANCE_H
 #define INSTANCE_H
 
+#include <cstddef>
 #include <filesystem>
+#include <memory>
 #include <vector>
 
 struct Instance {
@@ -12,18 +14,21 @@ struct Instance {
     size_t num_machines() const { return m_num_machines; }
     const std::vector<size_t> &processing_times_sum() const { return m_processing_times_sum; }
 
-    long p(size_t i, size_t j) const { return m_matrix[i][j]; }
+    long p(size_t i, size_t j) const { return m_matrix.get()[i * m_num_machines + j]; }
     // Reverse matrix
-    long rp(size_t i, size_t j) const { return m_matrix[i][m_num_machines - j - 1]; }
+    long rp(size_t i, size_t j) const { return m_matrix.get()[i * m_num_machines + m_num_machines - j - 1]; }
 
     Instance create_reverse_instance();
 
   private:
     size_t m_num_jobs = 0;
     size_t m_num_machines = 0;
-    std::vector<std::vector<long>> m_matrix;
+    // Row-major, owned or a view into a memory-mapped binary instance
+    std::shared_ptr<const long> m_matrix;
     std::vector<size_t> m_processing_times_sum;
 
+    void parse_text(const std::filesystem::path &path);
+    void load_binary(const std::filesystem::path &path);
     void calculate_processing_times_sum();
 };
 
@@ -11,6 +11,7 @@
 #include "PF_NEH.h"
 #include "RLS.h"
 #include "Solution.h"
+#include "Stats.h"
 
 static const double EPSILON = std::numeric_limits<double>::min();
 
@@ -70,20 +71,12 @@ void Population::calculate_seeds(size_t s_min, size_t s_max) {
 }
 
 Population DIWO::population_init() {
-    Solution best;
-
-    const std::vector<size_t> stpt = core::stpt_sort(m_instance);
+    STATS_TIME(Initial);
     const size_t lambda = m_instance.num_jobs() >= 25 ? 25 : m_instance.num_jobs();
 
-    for (size_t i = 0; i < 5; ++i) {
-        PF_NEH pf_neh(m_instance);
-
-        const Solution sol = pf_neh.solve(lambda, i);
-
-        if (sol.cost < best.cost) {
-            best = sol;
-        }
-    }
+    // The five PF-NEH starts are independent, so they run in parallel
+    PF_NEH pf_neh(m_instance);
+    Solution best = pf_neh.multi_start(lambda, 5);
 
     // Calling it to set the departure times
     core::recalculate_solution(m_instance, best);
@@ -130,6 +123,7 @@ size_t DIWO::get_solution_d(const double deviation) {
 }
 
 Population DIWO::spatial_dispersal(const Population &pop) {
+    STATS_TIME(Construction);
     Population new_pop;
     NEH neh(m_instance);
 
@@ -143,8 +137,13 @@ Population DIWO::spatial_dispersal(const Population &pop) {
     for (size_t i = 0; i < pop.solutions.size(); ++i) {
         const auto &sol = pop.solutions[i];
 
-        double deviation = ((1 - static_cast<double>(uptime()) / static_cast<double>(max_time)) *
-                            static_cast<double>(m_params.sigma_max() - m_params.sigma_min())) +
+        // Share of the run already spent, counted in evaluations when the run has an evaluation budget
+        const double progress =
+            m_params.evaluations()
+                ? static_cast<double>(core::evaluations()) / static_cast<double>(*m_params.evaluations())
+                : static_cast<double>(uptime()) / static_cast<double>(max_time);
+
+        double deviation = ((1 - progress) * static_cast<double>(m_params.sigma_max() - m_params.sigma_min())) +
                            static_cast<double>(m_params.sigma_min());
         if (static_cast<double>(sol.cost) > median) {
             deviation *= ((static_cast<double>(sol.cost) - median) /
@@ -152,6 +151,10 @@ Population DIWO::spatial_dispersal(const Population &pop) {
                              0.5 + 1;
         }
         for (size_t j = 0; j < static_cast<size_t>(pop.seeds[i]); ++j) {
+            // A generation is long, so the budget is also checked for every seed and not only in solve()
+            if (core::budget_spent()) {
+                return new_pop;
+            }
 
             const size_t d = get_solution_d(deviation);
 
@@ -172,7 +175,7 @@ Population DIWO::spatial_dispersal(const Population &pop) {
                 return m_instance.processing_times_sum()[a] < m_instance.processing_times_sum()[b];
             });
 
-            neh.second_step(std::move(pi_r), sol_copy);
+            neh.second_step(pi_r, sol_copy);
 
             new_pop.add_solution(std::move(sol_copy));
         }
@@ -181,12 +184,16 @@ Population DIWO::spatial_dispersal(const Population &pop) {
 }
 
 void DIWO::local_search(Population &pop) {
+    STATS_TIME(LocalSearch);
     for (size_t i = 0; i < pop.solutions.size(); i++) {
         if (RNG::instance().generate_real_number(0.0, 1.0) < m_params.pls()) {
             continue;
         }
         std::vector<size_t> ref = pop.solutions[pop.best_solution_idx].sequence;
         for (size_t j = 0; j < 2; j++) {
+            if (core::budget_spent()) {
+                return;
+            }
             rls_grabowski(pop.solutions[i], ref, m_instance);
             // Update best solution if it's found by rls
             if (pop.solutions[i].cost < pop.solutions[pop.best_solution_idx].cost) {
@@ -200,6 +207,7 @@ void DIWO::local_search(Population &pop) {
 }
 
 Population DIWO::competitive_exclusion(Population pop, Population new_pop) const {
+    STATS_TIME(Selection);
     Population competitive_pop;
 
     pop.solutions.reserve(pop.solutions.size() + new_pop.solutions.size());
@@ -244,10 +252,12 @@ Solution DIWO::solve() {
             ro.pop_back();
         }
 
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, pop.solutions[pop.best_solution_idx].cost)) {
             break;
         }
 
+        STATS_COUNT(Iteration);
+
         best = pop.solutions[pop.best_solution_idx];
         pop.calculate_seeds(m_params.s_min(), m_params.s_max());
 
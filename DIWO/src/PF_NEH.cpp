@@ -1,30 +1,68 @@
 #include "PF_NEH.h"
 #include "Core.h"
 #include "Instance.h"
+#include "Parallel.h"
 #include "NEH.h"
 #include "PF.h"
 
+#include <limits>
+
 PF_NEH::PF_NEH(Instance &instance) : m_instance(instance) {};
 
-Solution PF_NEH::solve(size_t lambda, size_t stpt_index) {
+std::vector<size_t> PF_NEH::pf_phase(size_t lambda, size_t stpt_index, Solution &s) {
 
     const size_t n = m_instance.num_jobs();
 
     PF pf(m_instance);
-    NEH neh(m_instance);
 
     // generate initial solution with PF algorithm
-    Solution s;
     const std::vector<size_t> stpt = core::stpt_sort(m_instance);
     pf.pf_insertion_phase(s, stpt[stpt_index]);
 
     // apply the NEH algorithm with 0 to n - lambda jobs from the PF solution
-    const std::vector<size_t> candidate_jobs = {s.sequence.begin() + (long)(n - lambda + 1), s.sequence.end()};
+    std::vector<size_t> candidate_jobs = {s.sequence.begin() + (long)(n - lambda + 1), s.sequence.end()};
     s.sequence = {s.sequence.begin(),
                   s.sequence.begin() +
                       (long)(n - lambda + 1)}; // needs to be n - lambda + 1 because [first_pos, last_post)
 
+    return candidate_jobs;
+}
+
+Solution PF_NEH::solve(size_t lambda, size_t stpt_index) {
+
+    NEH neh(m_instance);
+
+    Solution s;
+    std::vector<size_t> candidate_jobs = pf_phase(lambda, stpt_index, s);
+
     neh.second_step(candidate_jobs, s);
 
     return s;
 }
+
+Solution PF_NEH::multi_start(size_t lambda, size_t starts) {
+
+    std::vector<Solution> results(starts);
+    std::vector<char> finished(starts, false); // not vector<bool>, workers write to different elements
+    std::atomic<size_t> best_cost{std::numeric_limits<size_t>::max()};
+
+    parallel_for(starts, [&](size_t i) {
+        NEH neh(m_instance);
+        std::vector<size_t> candidate_jobs = pf_phase(lambda, i, results[i]);
+
+        if (neh.second_step(candidate_jobs, results[i], best_cost)) {
+            finished[i] = true;
+            atomic_min(best_cost, results[i].cost);
+        }
+    });
+
+    // Ties go to the lowest start, a start is only abandoned when strictly worse so this one always finishes
+    size_t best = starts;
+    for (size_t i = 0; i < starts; i++) {
+        if (finished[i] && (best == starts || results[i].cost < results[best].cost)) {
+            best = i;
+        }
+    }
+
+    return results[best];
+}
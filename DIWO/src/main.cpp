@@ -2,10 +2,12 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "Core.h"
 #include "DIWO.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -15,10 +17,32 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"DIWO", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
     try {
+        const bool print_stats = params.stats();
         Instance instance(params.instance_path());
         DIWO diwo(std::move(instance), std::move(params));
-        std::cout << diwo.solve().cost << '\n';
+        const Solution best = diwo.solve();
+        std::cout << best.cost << '\n';
+        core::report_evaluations(std::cerr);
+        core::report_target(std::cerr);
+        core::write_trace(best.cost);
+
+        if (print_stats) {
+            stats::print(std::cerr);
+        }
     } catch (std::runtime_error &err) {
         std::cerr << err.what() << '\n';
         exit(EXIT_FAILURE);
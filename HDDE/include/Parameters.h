@@ -11,7 +11,11 @@ class Parameters {
 
     const std::string &instance_path() const { return m_instance_path; }
     bool verbose() const { return m_verbose; }
+    bool stats() const { return m_stats; }
     std::optional<size_t> seed() const { return m_seed; }
+    std::optional<size_t> evaluations() const { return m_evaluations; }
+    std::optional<size_t> target() const { return m_target; }
+    const std::optional<std::string> &trace() const { return m_trace; }
     bool benchmark() const { return m_benchmark; }
     size_t ro() const { return m_ro; }
     size_t ps() const { return m_ps; }
@@ -22,7 +26,11 @@ class Parameters {
   private:
     std::string m_instance_path;
     bool m_verbose = false;
+    bool m_stats = false;
     std::optional<size_t> m_seed;
+    std::optional<size_t> m_evaluations;
+    std::optional<size_t> m_target;
+    std::optional<std::string> m_trace;
     bool m_benchmark = false;
     size_t m_ro = 100;
     size_t m_ps = 20;
@@ -2,9 +2,59 @@
 
 #include "Instance.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+// Atomic since the constructions may evaluate from several threads at once
+std::atomic<size_t> g_evaluations{0};
+size_t g_evaluation_budget = 0; // 0 means the run is limited by time only
+size_t g_target = 0;            // 0 means there is no target
+std::optional<std::chrono::duration<double>> g_time_to_target;
+const std::chrono::steady_clock::time_point g_start = std::chrono::steady_clock::now();
+
+struct Improvement {
+    size_t elapsed_ns;
+    size_t evaluations;
+    size_t cost;
+};
+
+std::optional<std::string> g_trace_path;
+core::RunInfo g_run_info;
+std::vector<Improvement> g_trace;
+
+void record_improvement(size_t cost) {
+    if (!g_trace_path || (!g_trace.empty() && g_trace.back().cost <= cost)) {
+        return;
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - g_start;
+    g_trace.push_back({static_cast<size_t>(std::chrono::nanoseconds(elapsed).count()), core::evaluations(), cost});
+}
+
+std::string json_string(const std::string &str) {
+    std::string escaped = "\"";
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped + '"';
+}
+} // namespace
+
+BFSP_KERNEL void core::calculate_departure_times(Instance &instance, Solution &s) {
+    count_evaluations();
 
-void core::calculate_departure_times(Instance &instance, Solution &s) {
     auto p = [&instance](size_t i, size_t j) { return instance.p(i, j); };
 
     // Calculate first job
@@ -27,7 +77,7 @@ void core::calculate_departure_times(Instance &instance, Solution &s) {
     }
 }
 
-void core::calculate_tail(Instance &instance, Solution &s) {
+BFSP_KERNEL void core::calculate_tail(Instance &instance, Solution &s) {
 
     auto p = [&instance](size_t i, size_t j) { return instance.p(i, j); };
 
@@ -110,12 +160,14 @@ std::vector<size_t> core::calculate_new_departure_time(Instance &instance, std::
     return new_departure_time;
 }
 
-void core::partial_recalculate_solution(Instance &instance, Solution &s, size_t start) {
+BFSP_KERNEL void core::partial_recalculate_solution(Instance &instance, Solution &s, size_t start) {
     if (start == 0) {
         recalculate_solution(instance, s);
         return;
     }
 
+    count_evaluations();
+
     auto p = [&instance](size_t i, size_t j) { return instance.p(i, j); };
 
     // Recalculate departure times from start index to the end
@@ -150,3 +202,120 @@ void core::recalculate_solution(Instance &instance, Solution &s) {
     size_t last_index = s.sequence.size()-1 ;
     s.cost = s.departure_times[last_index].back();
 }
+
+size_t core::evaluations() { return g_evaluations.load(std::memory_order_relaxed); }
+
+void core::count_evaluations(size_t amount) { g_evaluations.fetch_add(amount, std::memory_order_relaxed); }
+
+void core::set_evaluation_budget(size_t budget) { g_evaluation_budget = budget; }
+
+void core::set_target(size_t target) { g_target = target; }
+
+bool core::should_stop(bool time_is_up, size_t best_cost) {
+    record_improvement(best_cost);
+
+    if (g_time_to_target) {
+        return true;
+    }
+
+    if (g_target != 0 && best_cost <= g_target) {
+        // Keep going for one more pass, the caller may not have accepted the solution that reached the target yet
+        g_time_to_target = std::chrono::steady_clock::now() - g_start;
+        return false;
+    }
+
+    if (g_evaluation_budget == 0) {
+        return time_is_up;
+    }
+    return evaluations() >= g_evaluation_budget;
+}
+
+bool core::budget_spent() { return g_evaluation_budget != 0 && evaluations() >= g_evaluation_budget; }
+
+void core::report_evaluations(std::ostream &os) {
+    if (g_evaluation_budget == 0) {
+        return;
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - g_start;
+    os << "evaluations: " << evaluations() << " in " << elapsed.count() << "s ("
+       << static_cast<double>(evaluations()) / elapsed.count() << "/s)\n";
+}
+
+void core::report_target(std::ostream &os) {
+    if (g_target == 0) {
+        return;
+    }
+
+    if (g_time_to_target) {
+        os << "target " << g_target << " reached in " << std::fixed << std::setprecision(6) << g_time_to_target->count()
+           << "s\n";
+    } else {
+        os << "target " << g_target << " not reached\n";
+    }
+}
+
+void core::enable_trace(std::string path, RunInfo info) {
+    g_trace_path = std::move(path);
+    g_run_info = std::move(info);
+    // Improvements get rarer as the search goes, this is enough for any run to never reallocate mid search
+    g_trace.reserve(4096);
+}
+
+void core::write_trace(size_t final_cost) {
+    if (!g_trace_path) {
+        return;
+    }
+
+    record_improvement(final_cost);
+
+    std::ofstream file(*g_trace_path);
+    if (!file) {
+        throw std::runtime_error("Could not write trace file");
+    }
+
+    if (std::filesystem::path(*g_trace_path).extension() == ".json") {
+        file << "{\n  \"algorithm\": " << json_string(g_run_info.algorithm) << ",\n  \"instance\": "
+             << json_string(g_run_info.instance) << ",\n  \"seed\": " << g_run_info.seed << ",\n  \"arguments\": [";
+        for (size_t i = 0; i < g_run_info.arguments.size(); i++) {
+            file << (i == 0 ? "" : ", ") << json_string(g_run_info.arguments[i]);
+        }
+        file << "],\n  \"trace\": [";
+        for (size_t i = 0; i < g_trace.size(); i++) {
+            file << (i == 0 ? "\n" : ",\n") << "    {\"time_ns\": " << g_trace[i].elapsed_ns
+                 << ", \"evaluations\": " << g_trace[i].evaluations << ", \"cost\": " << g_trace[i].cost << "}";
+        }
+        file << "\n  ]\n}\n";
+        return;
+    }
+
+    // Metadata goes in comment lines so the rows can be read by any CSV reader that skips them
+    file << "# algorithm: " << g_run_info.algorithm << "\n# instance: " << g_run_info.instance
+         << "\n# seed: " << g_run_info.seed << "\n# arguments:";
+    for (const std::string &argument : g_run_info.arguments) {
+        file << ' ' << argument;
+    }
+    file << "\ntime_ns,evaluations,cost\n";
+    for (const Improvement &improvement : g_trace) {
+        file << improvement.elapsed_ns << ',' << improvement.evaluations << ',' << improvement.cost << '\n';
+    }
+}
+
+const char *core::selected_isa() {
+#if defined(BFSP_DISPATCH) && defined(__x86_64__) && defined(__ELF__)
+    // Same order of preference as the resolvers generated for target_clones
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return "avx512f";
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return "avx2";
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return "sse4.2";
+    }
+    return "default";
+#else
+    return "none (built without runtime dispatch)";
+#endif
+}
@@ -6,6 +6,8 @@
 #include <iostream>
 #include <limits>
 
+#include "Stats.h"
+
 namespace {
 size_t uptime() {
     static const auto global_start_time = std::chrono::steady_clock::now();
@@ -42,6 +44,7 @@ bool HDDE::new_in_population(std::vector<size_t> &sequence) {
 }
 
 void HDDE::generate_initial_pop() {
+    STATS_TIME(Initial);
 
     m_pop = std::vector<Solution>(1);
 
@@ -70,6 +73,7 @@ std::vector<size_t> HDDE::generate_random_sequence() {
 }
 
 std::vector<size_t> HDDE::mutation() {
+    STATS_TIME(Mutation);
     const size_t n = m_instance.num_jobs();
 
     // taking three random solutions
@@ -100,6 +104,7 @@ std::vector<size_t> HDDE::mutation() {
 }
 
 Solution HDDE::crossover(std::vector<size_t> &pi) {
+    STATS_TIME(Crossover);
     const size_t n = m_instance.num_jobs();
     std::vector<size_t> pi_temp;
 
@@ -198,13 +203,25 @@ Solution HDDE::solve() {
     std::iota(ref.begin(), ref.end(), 0);
 
     while (true) {
+        STATS_COUNT(Iteration);
+
         for (auto &i : m_pop) {
+            // Every trial goes through rls, so the budget is also checked for each individual and not only once per
+            // generation
+            if (core::budget_spent()) {
+                break;
+            }
+
             Solution trial = generate_new_solution();
 
-            std::shuffle(ref.begin(), ref.end(), RNG::instance().gen());
+            {
+                STATS_TIME(LocalSearch);
+                std::shuffle(ref.begin(), ref.end(), RNG::instance().gen());
 
-            rls_grabowski(trial, ref, m_instance);
+                rls_grabowski(trial, ref, m_instance);
+            }
 
+            STATS_TIME(Selection);
             if (trial.cost < i.cost) {
                 i = trial;
             }
@@ -217,7 +234,7 @@ Solution HDDE::solve() {
             ro.pop_back();
         }
 
-        if (uptime() > m_time_limit) {
+        if (core::should_stop(uptime() > m_time_limit, std::min(best_solution.cost, m_pop[idx].cost))) {
             break;
         }
 
@@ -3,10 +3,12 @@
 #include <iostream>
 #include <numeric>
 
+#include "Core.h"
 #include "HDDE.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -17,10 +19,32 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"HDDE", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
+    const bool print_stats = params.stats();
+
     HDDE hdde = HDDE(std::move(instance), params);
     const Solution s = hdde.solve();
 
     std::cout << s.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(s.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 
     return 0;
 }
\ No newline at end of file
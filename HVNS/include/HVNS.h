@@ -4,6 +4,7 @@
 #include "Core.h"
 #include "Instance.h"
 #include "Log.h"
+#include "Parallel.h"
 #include "Parameters.h"
 #include "RNG.h"
 #include "Solution.h"
@@ -68,6 +69,11 @@ class HVNS {
     double m_beta;   // cooling adjustment
     Solution m_inner;
     std::vector<std::vector<size_t>> m_f;
+
+    // Positions 1..size of taillard_best_insertion split among the workers of pool, with the same result. best is the
+    // {index, makespan} the scan starts from
+    std::pair<size_t, size_t> parallel_insertion_scan(WorkerPool &pool, size_t job, size_t size,
+                                                      size_t original_position, std::pair<size_t, size_t> best);
 };
 
 #endif
\ No newline at end of file
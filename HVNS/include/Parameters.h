@@ -11,8 +11,12 @@ class Parameters {
 
     const std::string &instance_path() const { return m_instance_path; }
     bool verbose() const { return m_verbose; }
+    bool stats() const { return m_stats; }
     bool benchmark() const { return m_benchmark; }
     std::optional<size_t> seed() const { return m_seed; }
+    std::optional<size_t> evaluations() const { return m_evaluations; }
+    std::optional<size_t> target() const { return m_target; }
+    const std::optional<std::string> &trace() const { return m_trace; }
     std::optional<size_t> time_limit() const { return m_tl; }
     size_t ro() const { return m_ro; }
     size_t n_iter() const { return m_n_iter; }
@@ -20,8 +24,12 @@ class Parameters {
   private:
     std::string m_instance_path;
     bool m_verbose = false;
+    bool m_stats = false;
     bool m_benchmark = false;
     std::optional<size_t> m_seed;
+    std::optional<size_t> m_evaluations;
+    std::optional<size_t> m_target;
+    std::optional<std::string> m_trace;
     std::optional<size_t> m_tl;
     size_t m_ro = 100;
     size_t m_n_iter = 1800000;
@@ -1,10 +1,14 @@
 #include "HVNS.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <vector>
+
+#include "Stats.h"
 
 namespace {
 size_t uptime() {
@@ -13,6 +17,9 @@ size_t uptime() {
     auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - global_start_time);
     return duration.count();
 }
+
+// Below this many departure time cells a best insertion is too short to pay for waking the shared pool
+constexpr size_t PARALLEL_INSERTION_CELLS = 1 << 16;
 } // namespace
 
 HVNS::HVNS(Instance instance, Parameters params) : m_instance(std::move(instance)), m_params(std::move(params)) {
@@ -40,6 +47,7 @@ HVNS::HVNS(Instance instance, Parameters params) : m_instance(std::move(instance
 }
 
 size_t HVNS::insert_calculation(const size_t i, const size_t k, const size_t best_value) {
+    STATS_COUNT(InsertCalculation);
     size_t max_value = 0;
 
     auto p = [this](size_t i, size_t j) { return m_instance.p(i, j); };
@@ -56,6 +64,7 @@ size_t HVNS::insert_calculation(const size_t i, const size_t k, const size_t bes
     set_f_and_max(i, 0, value);
 
     if (max_value >= best_value) {
+        STATS_COUNT(InsertEarlyExit);
         return max_value;
     }
 
@@ -64,6 +73,7 @@ size_t HVNS::insert_calculation(const size_t i, const size_t k, const size_t bes
         set_f_and_max(i, j, value);
 
         if (max_value >= best_value) {
+            STATS_COUNT(InsertEarlyExit);
             return max_value;
         }
     }
@@ -74,11 +84,28 @@ size_t HVNS::insert_calculation(const size_t i, const size_t k, const size_t bes
     return max_value;
 }
 
-std::pair<size_t, size_t> HVNS::taillard_best_insertion(const std::vector<size_t> &s, size_t job,size_t original_position) {
+BFSP_KERNEL std::pair<size_t, size_t> HVNS::taillard_best_insertion(const std::vector<size_t> &s, size_t job,size_t original_position) {
+    core::count_evaluations(s.size());
+    STATS_COUNT(BestInsertion);
     m_inner.sequence = s;
 
-    core::calculate_departure_times(m_instance, m_inner);
-    core::calculate_tail(m_instance, m_inner);
+    // Large insertions borrow the shared pool, unless some other one already holds it
+    SharedPoolLease lease(s.size() * m_instance.num_machines() >= PARALLEL_INSERTION_CELLS);
+    WorkerPool *pool = lease.get();
+
+    if (pool != nullptr) {
+        // The departure times and the tails are independent recurrences
+        pool->run(2, [this](size_t w) {
+            if (w == 0) {
+                core::calculate_departure_times(m_instance, m_inner);
+            } else {
+                core::calculate_tail(m_instance, m_inner);
+            }
+        });
+    } else {
+        core::calculate_departure_times(m_instance, m_inner);
+        core::calculate_tail(m_instance, m_inner);
+    }
     // Make it easier to implement find_best_insertion
     // without an out of bound access
     // inner.tail.emplace_back(m_instance.num_machines(), 0);
@@ -108,6 +135,10 @@ std::pair<size_t, size_t> HVNS::taillard_best_insertion(const std::vector<size_t
         best_value = std::numeric_limits<size_t>::max();
     }
 
+    if (pool != nullptr) {
+        return parallel_insertion_scan(*pool, job, s.size(), original_position, {best_index, best_value});
+    }
+
     for (size_t i = 1; i <= s.size(); i++) {
         if (original_position == i) {
             continue;
@@ -124,9 +155,49 @@ std::pair<size_t, size_t> HVNS::taillard_best_insertion(const std::vector<size_t
     return {best_index, best_value};
 }
 
+std::pair<size_t, size_t> HVNS::parallel_insertion_scan(WorkerPool &pool, size_t job, size_t size,
+                                                        size_t original_position, std::pair<size_t, size_t> best) {
+    // Each worker scans one contiguous range of positions, sharing the best makespan for the early exits. Positions
+    // that tie the shared best are still evaluated in full, so the lowest one wins exactly as in the serial scan
+    std::atomic<size_t> shared_best{best.second};
+    std::vector<std::pair<size_t, size_t>> found(pool.size(), best);
+
+    pool.run([&](size_t w) {
+        auto &[best_index, value] = found[w];
+        const size_t last = 1 + ((w + 1) * size / pool.size());
+
+        for (size_t i = 1 + (w * size / pool.size()); i < last; i++) {
+            if (original_position == i) {
+                continue;
+            }
+
+            // The + 1 lets the ties through, unless the shared best is still the max as nothing was found yet
+            const size_t shared = shared_best.load(std::memory_order_relaxed);
+            const size_t bound = std::min(value, shared == std::numeric_limits<size_t>::max() ? shared : shared + 1);
+            const size_t max_value = insert_calculation(i, job, bound);
+
+            if (max_value < bound) {
+                value = max_value;
+                best_index = i;
+                atomic_min(shared_best, max_value);
+            }
+        }
+    });
+
+    for (const auto &candidate : found) {
+        if (candidate.second < best.second) {
+            best = candidate;
+        }
+    }
+
+    return best;
+}
+
 std::pair<size_t, size_t> HVNS::taillard_best_edge_insertion(const std::vector<size_t> &s,
                                                              std::pair<size_t, size_t> &jobs,
                                                              size_t original_position) {
+    core::count_evaluations(s.size());
+    STATS_COUNT(BestInsertion);
                                                                  
     const size_t m = m_instance.num_machines();
     m_inner.sequence = s;
@@ -232,6 +303,7 @@ Solution HVNS::neh(std::vector<size_t> phi) {
 }
 
 Solution HVNS::generate_first_solution() {
+    STATS_TIME(Initial);
 
     const std::vector<size_t> sorted_sequece = core::stpt_sort(m_instance);
 
@@ -377,6 +449,7 @@ void HVNS::best_swap(Solution &s) {
 }
 
 void HVNS::shaking(Solution &s, size_t k) {
+    STATS_TIME(Shaking);
 
     Solution copy = s;
     switch (k) {
@@ -397,10 +470,16 @@ void HVNS::shaking(Solution &s, size_t k) {
 }
 
 void HVNS::sa_rls(Solution &current, Solution &best) {
+    STATS_COUNT(RlsCall);
 
     std::vector<size_t> ref = generate_random_sequence();
     size_t cnt = 0;
     while (cnt < m_instance.num_jobs()) {
+        // Every accepted move restarts the pass, so the budget has to be checked here and not only in solve()
+        if (core::budget_spent()) {
+            return;
+        }
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[cnt];
         size_t i = 0;
@@ -417,6 +496,7 @@ void HVNS::sa_rls(Solution &current, Solution &best) {
 
         if (delta != 0 &&
             (!(best_nei_obj > current.cost) || RNG::instance().generate_real_number(0, 1) < exp(delta / m_T))) {
+            STATS_COUNT(RlsImprovement);
             current.sequence.insert(current.sequence.begin() + best_index, job);
             current.cost = best_nei_obj;
             std::shuffle(ref.begin(), ref.end(), RNG::instance().gen());
@@ -439,6 +519,10 @@ void HVNS::sa_best_edge_insertion(Solution &current, Solution &best) {
     std::vector<size_t> ref = generate_random_sequence();
     size_t cnt = 0;
     while (cnt < m_instance.num_jobs()) {
+        if (core::budget_spent()) {
+            return;
+        }
+
         std::pair<size_t, size_t> jobs;
         jobs.first = ref[cnt];
 
@@ -501,6 +585,7 @@ Solution HVNS::solve() {
         size_t k = 1;
 
         while (k <= KMAX) {
+            STATS_COUNT(Iteration);
 
             shaking(current, k);
 
@@ -510,7 +595,7 @@ Solution HVNS::solve() {
                 ro.pop_back();
             }
 
-            if (uptime() > m_time_limit) {
+            if (core::should_stop(uptime() > m_time_limit, std::min(best_solution.cost, current.cost))) {
                 break;
             }
 
@@ -518,6 +603,7 @@ Solution HVNS::solve() {
                 best_solution = current;
             }
 
+            STATS_TIME(LocalSearch);
             Solution temp;
             do {
                 sa_rls(current, best_solution);
@@ -533,13 +619,13 @@ Solution HVNS::solve() {
                     ro.pop_back();
                 }
 
-                if (uptime() > m_time_limit) {
+                if (core::should_stop(uptime() > m_time_limit, best_solution.cost)) {
                     break;
                 }
 
             } while (!equal_solution(current, temp));
 
-            if (uptime() > m_time_limit) {
+            if (core::should_stop(uptime() > m_time_limit, best_solution.cost)) {
                 break;
             }
 
@@ -560,7 +646,7 @@ Solution HVNS::solve() {
             ro.pop_back();
         }
 
-        if (uptime() > m_time_limit) {
+        if (core::should_stop(uptime() > m_time_limit, best_solution.cost)) {
             break;
         }
     }
@@ -1,6 +1,9 @@
 #include "Parameters.h"
 
+#include "Core.h"
 #include "argparse/argparse.hpp"
+#include <cstdlib>
+#include <iostream>
 
 namespace {
 void config_argparse(argparse::ArgumentParser &cli) {
@@ -9,6 +12,28 @@ void config_argparse(argparse::ArgumentParser &cli) {
 
     cli.add_argument("-s", "--seed").help("set random number generator seed").metavar("SEED").scan<'i', size_t>();
 
+    cli.add_argument("--evaluations")
+        .help("stop once this many makespan evaluations are spent instead of on the time limit, the step running "
+              "then finishes first so the count reported at the end may be a bit higher")
+        .metavar("EVALUATIONS")
+        .scan<'i', size_t>();
+    cli.add_argument("--target")
+        .help("stop as soon as a solution with at most this makespan is found")
+        .metavar("MAKESPAN")
+        .scan<'i', size_t>();
+    cli.add_argument("--trace")
+        .help("write every improvement of the best solution to this file, as JSON if it ends in .json or CSV")
+        .metavar("PATH");
+    cli.add_argument("--print-isa")
+        .help("print the instruction set the hot kernels were dispatched to and exit")
+        .action([](const std::string &) {
+            std::cout << core::selected_isa() << '\n';
+            std::exit(0);
+        })
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
     cli.add_argument("-v", "--verbose").help("set program verbosity").metavar("VERBOSE").default_value(false).flag();
 
     cli.add_argument("-b", "--benchmark")
@@ -17,6 +42,11 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .default_value(false)
         .flag();
 
+    cli.add_argument("--stats")
+        .help("print the hot-path counters and phase times to stderr at exit")
+        .default_value(false)
+        .flag();
+
     cli.add_argument("-t", "--time")
         .help("set the time limit for the program")
         .metavar("TIME_LIMIT")
@@ -55,8 +85,12 @@ Parameters::Parameters(int argc, char **argv) {
     // Set members
     m_instance_path = cli.get<std::string>("instance");
     m_verbose = cli.get<bool>("--verbose");
+    m_stats = cli.get<bool>("--stats");
     m_benchmark = cli.get<bool>("--benchmark");
     m_seed = cli.present<size_t>("--seed");
+    m_evaluations = cli.present<size_t>("--evaluations");
+    m_target = cli.present<size_t>("--target");
+    m_trace = cli.present<std::string>("--trace");
     m_tl = cli.present<size_t>("--time");
     m_ro = cli.get<size_t>("--ro");
     m_n_iter = cli.get<size_t>("--iterations");
@@ -3,10 +3,12 @@
 #include <iostream>
 #include <numeric>
 
+#include "Core.h"
 #include "HVNS.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -17,7 +19,29 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"HVNS", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
+    const bool print_stats = params.stats();
+
     HVNS hvns = HVNS(std::move(instance), params);
     const Solution best = hvns.solve();
     std::cout << best.cost << "\n";
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(best.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 }
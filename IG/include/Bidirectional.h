@@ -0,0 +1,15 @@
+#ifndef BIDIRECTIONAL_H
+#define BIDIRECTIONAL_H
+
+#include <functional>
+
+#include "Instance.h"
+#include "Solution.h"
+
+// Runs the same construction on the instance and on its reversed view concurrently. The schedule built for the
+// reverse problem is mapped back to the original one (a sequence on the reverse problem has the same makespan as
+// the reversed sequence on the original problem) and the best of both is returned
+Solution bidirectional_construction(Instance &instance, Instance &reverse_instance,
+                                    const std::function<Solution(Instance &)> &construction);
+
+#endif
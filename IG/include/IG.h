@@ -5,6 +5,8 @@
 #include "Parameters.h"
 #include "Solution.h"
 
+#include <random>
+
 class IG {
   public:
     IG(Instance instance, Parameters params);
@@ -14,11 +16,13 @@ class IG {
     // This is a implementation of the mme2 algorithm, a variation of neh using min max as the first step
     Solution initial_solution();
 
-    // Pretty straight foward local search using a first improvement swap
-    Solution local_search(Solution s);
+    // Pretty straight foward local search using a first improvement swap, from start into s. copy is scratch space,
+    // s and copy keep their buffers between calls
+    void local_search(const Solution &start, Solution &s, Solution &copy);
 
-    // Random destroy solution using the parameter d defined on the params struct
-    std::vector<size_t> destroy(Solution &s);
+    // Random destroy solution using the parameter d defined on the params struct, drawing positions from gen. The
+    // removed jobs go to removed, which is cleared first
+    void destroy(Solution &s, std::vector<size_t> &removed, std::mt19937 &gen);
 
     // These classes are "imutable" all their members are private and there is no "set" method for those members
     // almost like a read only memory
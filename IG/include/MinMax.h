@@ -2,16 +2,22 @@
 #define MINMAX_H
 #include "Instance.h"
 #include "Solution.h"
+#include "TransitionMatrix.h"
+
+#include <memory>
 
 class MinMax {
   public:
     // alpha parameter value got from Roconi paper, https://doi.org/10.1016/S0925-5273(03)00065-3
     MinMax(Instance &instance, double alpha = 0.60);
+    // Same as above but reusing a transition matrix already built for this instance (or for its reversed view)
+    MinMax(Instance &instance, std::shared_ptr<const TransitionMatrix> transition, double alpha = 0.60);
     Solution solve();
 
   private:
-    Instance m_instance;
+    Instance &m_instance;
     double m_alpha;
+    std::shared_ptr<const TransitionMatrix> m_transition;
 };
 
 #endif
@@ -0,0 +1,32 @@
+#ifndef TRANSITION_MATRIX_H
+#define TRANSITION_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Instance.h"
+
+// n x n job-pair transition costs, computed once per instance. The entry (last, next) is the sum over the machines of
+// |p(next, j) - p(last, j + 1)|, the idle/blocking mismatch of the Ronconi expression when next is sequenced right
+// after last. On the reverse problem that same sum is the entry (next, last), so one matrix serves both directions
+class TransitionMatrix {
+  public:
+    TransitionMatrix(const Instance &instance);
+
+    // Cost of sequencing next right after last on the given instance, which may be the reversed view of the one the
+    // matrix was built from
+    std::int32_t cost(const Instance &instance, size_t last, size_t next) const {
+        if (instance.is_reversed() != m_reversed) {
+            return m_costs[next * m_num_jobs + last];
+        }
+        return m_costs[last * m_num_jobs + next];
+    }
+
+  private:
+    size_t m_num_jobs = 0;
+    bool m_reversed = false;
+    std::vector<std::int32_t> m_costs;
+};
+
+#endif
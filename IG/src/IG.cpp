@@ -4,18 +4,26 @@
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <ostream>
+#include <random>
 #include <vector>
 
+#include "Bidirectional.h"
 #include "Core.h"
 #include "Instance.h"
+#include "LocalOptimaCache.h"
 #include "Log.h"
 #include "MinMax.h"
 #include "NEH.h"
+#include "Parallel.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
+#include "TransitionMatrix.h"
 
 namespace {
 size_t uptime() {
@@ -31,24 +39,16 @@ IG::IG(Instance instance, Parameters params)
       m_params(std::move(params)) {}
 
 Solution IG::initial_solution() {
-    Solution best;
-
-    // Direct MME
-    MinMax mm(m_instance);
-    NEH neh(m_instance);
-    Solution normal = neh.solve(mm.solve().sequence);
-    // core::recalculate_solution(normal);
-
-    // Reverse MME
-    MinMax mmr(m_instance);
-    NEH nehr(m_instance);
-    Solution jobs_reversed = nehr.solve(mmr.solve().sequence);
-    std::reverse(jobs_reversed.sequence.begin(), jobs_reversed.sequence.end());
-    core::recalculate_solution(m_instance, jobs_reversed);
-
-    best = normal.cost < jobs_reversed.cost ? std::move(normal) : std::move(jobs_reversed);
-
-    return best;
+    STATS_TIME(Initial);
+    // The transition matrix of the reverse problem is the transpose of the direct one, so both directions share it
+    auto transition = std::make_shared<const TransitionMatrix>(m_instance);
+
+    // MME on the direct problem and on the reverse one, keeping the best of them
+    return bidirectional_construction(m_instance, m_instance_reverse, [&transition](Instance &instance) {
+        MinMax mm(instance, transition);
+        NEH neh(instance);
+        return neh.solve(mm.solve().sequence);
+    });
 }
 
 Solution IG::solve() {
@@ -75,10 +75,61 @@ Solution IG::solve() {
     }
 
     VERBOSE(m_params.verbose()) << "Time limit: " << time_limit << "s\n";
-    NEH neh(m_instance);
+    // The local search is deterministic, so its result only depends on the constructed sequence
+    LocalOptimaCache cache(m_params.cache());
+
+    // Every iteration builds one candidate per worker from current, worker 0 keeps the global random stream so a
+    // single worker behaves exactly as the serial algorithm
+    WorkerPool pool(m_params.workers());
+    std::vector<std::mt19937> generators;
+    for (size_t w = 1; w < pool.size(); w++) {
+        generators.emplace_back(RNG::instance().gen()());
+    }
+    std::vector<NEH> helpers(pool.size(), NEH(m_instance));
+    // Each worker keeps the constructed solution too, a rejected local optimum leaves current at the construction.
+    // All of these are per worker buffers reused by every iteration
+    std::vector<Solution> constructed(pool.size());
+    std::vector<Solution> searched(pool.size());
+    std::vector<Solution> copies(pool.size());
+    std::vector<std::vector<size_t>> removed(pool.size());
+    std::vector<std::uint64_t> keys(pool.size());
+    std::vector<char> hits(pool.size());
+    bool first = true;
 
     while (true) {
-        Solution incumbent = local_search(current);
+        STATS_COUNT(Iteration);
+
+        pool.run([&](size_t w) {
+            Solution &candidate = constructed[w];
+            candidate = current;
+
+            // The initial solution goes through the local search as it is
+            if (!first || w != 0) {
+                destroy(candidate, removed[w], w == 0 ? RNG::instance().gen() : generators[w - 1]);
+
+                STATS_TIME(Construction);
+                helpers[w].second_step(removed[w], candidate); // Construct phase
+            }
+
+            keys[w] = LocalOptimaCache::hash(candidate.sequence);
+            hits[w] = cache.find(keys[w], searched[w]);
+            if (!hits[w]) {
+                local_search(candidate, searched[w], copies[w]);
+            }
+        });
+        first = false;
+
+        // Lowest makespan wins, ties go to the lowest worker so the outcome does not depend on the schedule
+        size_t chosen = 0;
+        for (size_t w = 0; w < pool.size(); w++) {
+            if (!hits[w]) {
+                cache.insert(keys[w], searched[w]);
+            }
+            if (searched[w].cost < searched[chosen].cost) {
+                chosen = w;
+            }
+        }
+        Solution &incumbent = searched[chosen];
 
         if (!ro.empty() && uptime() >= (ro.back() * mxn) / 1000) {
 
@@ -86,31 +137,34 @@ Solution IG::solve() {
             ro.pop_back();
         }
         //  Program should not accept any solution if the time is out
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best.cost, incumbent.cost))) {
             break;
         }
         if (incumbent.cost < best.cost) {
             VERBOSE(m_params.verbose()) << "Found a new best\n";
             VERBOSE(m_params.verbose()) << incumbent;
-            best = current = std::move(incumbent);
+            best = current = incumbent;
         }
         // If the solution is worse than the best it's accepted 50% of the times
         else if (RNG::instance().generate(0, 1) == 1) {
-            current = std::move(incumbent);
+            std::swap(current, incumbent);
+        } else {
+            std::swap(current, constructed[chosen]);
         }
-
-        std::vector<size_t> removed = destroy(current);
-        neh.second_step(std::move(removed), current); // Construct phase
     }
 
+    VERBOSE(m_params.verbose()) << "Local optima cache hits: " << cache.hits() << " out of " << cache.lookups() << '\n';
+
     return best;
 }
 
-Solution IG::local_search(Solution s) {
+void IG::local_search(const Solution &start, Solution &s, Solution &copy) {
+    STATS_TIME(LocalSearch);
     // Set departure times matrix
+    s = start;
     core::recalculate_solution(m_instance, s);
 
-    Solution copy = s;
+    copy = s;
     bool improved = true;
 
     while (improved) {
@@ -140,22 +194,20 @@ Solution IG::local_search(Solution s) {
             copy.departure_times[i] = s.departure_times[i];
         }
     }
-    return s;
 }
 
-std::vector<size_t> IG::destroy(Solution &s) {
+void IG::destroy(Solution &s, std::vector<size_t> &removed, std::mt19937 &gen) {
+    STATS_TIME(Destruction);
 
     // This mostly avoids crashes on really small toy instances
     const size_t destroy_size = std::min(s.sequence.size() - 1, m_params.d());
 
-    std::vector<size_t> removed;
-    removed.reserve(destroy_size);
+    removed.clear();
     // Random remove d nodes
     for (size_t i = 0; i < destroy_size; i++) {
-        const long chose = RNG::instance().generate<long>(0, ((long)s.sequence.size()) - 1);
+        std::uniform_int_distribution<long> dis(0, ((long)s.sequence.size()) - 1);
+        const long chose = dis(gen);
         removed.push_back(s.sequence[chose]);
         s.sequence.erase(s.sequence.begin() + chose);
     }
-
-    return removed;
 }
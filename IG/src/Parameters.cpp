@@ -1,6 +1,10 @@
 #include "Parameters.h"
 
+#include "Core.h"
 #include "argparse/argparse.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
 
 namespace {
 void config_argparse(argparse::ArgumentParser &cli) {
@@ -8,6 +12,28 @@ void config_argparse(argparse::ArgumentParser &cli) {
     cli.add_argument("instance").help("instance path");
 
     cli.add_argument("-s", "--seed").help("set random number generator seed").metavar("SEED").scan<'i', size_t>();
+
+    cli.add_argument("--evaluations")
+        .help("stop once this many makespan evaluations are spent instead of on the time limit, the step running "
+              "then finishes first so the count reported at the end may be a bit higher")
+        .metavar("EVALUATIONS")
+        .scan<'i', size_t>();
+    cli.add_argument("--target")
+        .help("stop as soon as a solution with at most this makespan is found")
+        .metavar("MAKESPAN")
+        .scan<'i', size_t>();
+    cli.add_argument("--trace")
+        .help("write every improvement of the best solution to this file, as JSON if it ends in .json or CSV")
+        .metavar("PATH");
+    cli.add_argument("--print-isa")
+        .help("print the instruction set the hot kernels were dispatched to and exit")
+        .action([](const std::string &) {
+            std::cout << core::selected_isa() << '\n';
+            std::exit(0);
+        })
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
     cli.add_argument("-t", "--time")
         .help("set the time limit for the program")
         .metavar("TIME_LIMIT")
@@ -21,6 +47,11 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .default_value(false)
         .flag();
 
+    cli.add_argument("--stats")
+        .help("print the hot-path counters and phase times to stderr at exit")
+        .default_value(false)
+        .flag();
+
     cli.add_argument("-r", "--ro")
         .help("set the ro parameter which delimits the time limit of the program")
         .metavar("RO")
@@ -38,6 +69,19 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .metavar("DESTROY")
         .default_value(size_t(5))
         .scan<'i', size_t>();
+
+    cli.add_argument("--cache")
+        .help("number of constructed sequences whose local optimum is remembered, 0 disables the cache")
+        .metavar("ENTRIES")
+        .default_value(size_t(1024))
+        .scan<'i', size_t>();
+
+    cli.add_argument("--workers")
+        .help("number of destroy/construct/local search candidates built in parallel on each iteration, the best one "
+              "goes through the acceptance criterion")
+        .metavar("WORKERS")
+        .default_value(size_t(1))
+        .scan<'i', size_t>();
 }
 } // namespace
 
@@ -60,9 +104,15 @@ Parameters::Parameters(int argc, char **argv) {
     m_instance_path = cli.get<std::string>("instance");
     m_verbose = cli.get<bool>("--verbose");
     m_benchmark = cli.get<bool>("--benchmark");
+    m_stats = cli.get<bool>("--stats");
     m_seed = cli.present<size_t>("--seed");
+    m_evaluations = cli.present<size_t>("--evaluations");
+    m_target = cli.present<size_t>("--target");
+    m_trace = cli.present<std::string>("--trace");
     m_tl = cli.present<size_t>("--time");
     m_ro = cli.get<size_t>("--ro");
     m_alpha = cli.get<double>("--alpha");
     m_d = cli.get<size_t>("--destroy");
+    m_cache = cli.get<size_t>("--cache");
+    m_workers = std::max<size_t>(1, cli.get<size_t>("--workers"));
 }
@@ -0,0 +1,203 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Threads, besides the calling ones, that are currently running parallel_for or WorkerPool tasks. SharedPoolLease
+// stays serial while it is not zero, the machine is already busy with the parallelism of the caller
+inline std::atomic<size_t> &busy_threads() {
+    static std::atomic<size_t> threads{0};
+    return threads;
+}
+
+// Runs task(0), ..., task(count - 1) on a small pool of worker threads, every worker keeps taking the next pending
+// index until none is left. Tasks must only read shared data or synchronize by themselves
+inline void parallel_for(size_t count, const std::function<void(size_t)> &task) {
+    const size_t num_workers = std::min<size_t>(count, std::max(1U, std::thread::hardware_concurrency()));
+    std::atomic<size_t> next{0};
+    busy_threads() += num_workers - 1;
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++) {
+            task(i);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (size_t w = 1; w < num_workers; w++) {
+        workers.emplace_back(worker);
+    }
+
+    // The calling thread is a worker too
+    worker();
+
+    for (auto &t : workers) {
+        t.join();
+    }
+    busy_threads() -= num_workers - 1;
+}
+
+// Lowers value to candidate unless some other thread already stored something smaller
+inline void atomic_min(std::atomic<size_t> &value, size_t candidate) {
+    size_t current = value.load();
+    while (candidate < current && !value.compare_exchange_weak(current, candidate)) {
+    }
+}
+
+// Fixed set of threads that all run the same task on every run() call, for loops that go parallel on every iteration
+// and cannot pay for starting threads each time. The calling thread is worker 0, so a pool of one has no threads
+class WorkerPool {
+  public:
+    explicit WorkerPool(size_t num_workers) : m_wake(std::make_unique<std::condition_variable[]>(num_workers)) {
+        for (size_t w = 1; w < num_workers; w++) {
+            m_threads.emplace_back([this, w]() { loop(w); });
+        }
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+    WorkerPool(WorkerPool &&) = delete;
+    WorkerPool &operator=(WorkerPool &&) = delete;
+
+    ~WorkerPool() {
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        for (size_t w = 1; w < size(); w++) {
+            m_wake[w].notify_one();
+        }
+        for (auto &t : m_threads) {
+            t.join();
+        }
+    }
+
+    size_t size() const { return m_threads.size() + 1; }
+
+    // Runs task(0), ..., task(size() - 1) at the same time and returns once all of them finished. The task is only
+    // referenced through a plain pointer, so a run does not allocate whatever the task captures
+    template <typename Task> void run(Task &&task) { run(size(), std::forward<Task>(task)); }
+
+    // Same, but only task(0), ..., task(count - 1). Workers from count on are not woken up
+    template <typename Task> void run(size_t count, Task &&task) {
+        count = std::min(count, size());
+        if (count <= 1) {
+            if (count == 1) {
+                task(0);
+            }
+            return;
+        }
+
+        using TaskType = std::remove_reference_t<Task>;
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_task = const_cast<void *>(static_cast<const void *>(std::addressof(task)));
+            m_invoke = [](void *context, size_t worker) { (*static_cast<TaskType *>(context))(worker); };
+            m_active = count;
+            m_pending = count - 1;
+            m_generation++;
+        }
+        busy_threads() += count - 1;
+        for (size_t w = 1; w < count; w++) {
+            m_wake[w].notify_one();
+        }
+
+        task(0);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_pending == 0; });
+        busy_threads() -= count - 1;
+    }
+
+  private:
+    void loop(size_t worker) {
+        size_t seen = 0;
+        while (true) {
+            void *task = nullptr;
+            void (*invoke)(void *, size_t) = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake[worker].wait(lock, [this, worker, seen]() {
+                    return m_stop || (worker < m_active && m_generation != seen);
+                });
+                if (m_stop) {
+                    return;
+                }
+                seen = m_generation;
+                task = m_task;
+                invoke = m_invoke;
+            }
+
+            invoke(task, worker);
+
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_pending == 0) {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    // One per worker, so a run only wakes the workers it needs
+    std::unique_ptr<std::condition_variable[]> m_wake;
+    std::condition_variable m_done;
+    void *m_task = nullptr;
+    void (*m_invoke)(void *, size_t) = nullptr;
+    size_t m_generation = 0;
+    size_t m_active = 0;
+    size_t m_pending = 0;
+    bool m_stop = false;
+};
+
+// Hands the process wide pool to a single caller at a time. Meant for parallel sections inside one call (e.g. a large
+// best insertion) of an otherwise serial run: a caller that finds the pool busy, maybe because it is already running
+// inside one of its tasks, gets nullptr and runs serially, and so does everyone while busy_threads() is not zero, as
+// with --workers or --rls-workers above 1. The pool has one worker per hardware thread, the BFSP_INSERTION_THREADS
+// environment variable caps it, e.g. to 1 when a driver already runs one process per core
+class SharedPoolLease {
+  public:
+    explicit SharedPoolLease(bool wanted) {
+        if (wanted && busy_threads() == 0) {
+            m_lock = std::unique_lock<std::mutex>(mutex(), std::try_to_lock);
+        }
+    }
+
+    // nullptr unless the lease was wanted, the pool was free and it has more than one worker
+    WorkerPool *get() {
+        if (!m_lock.owns_lock()) {
+            return nullptr;
+        }
+        static WorkerPool pool(num_threads());
+        return pool.size() > 1 ? &pool : nullptr;
+    }
+
+  private:
+    static size_t num_threads() {
+        size_t threads = std::max(1U, std::thread::hardware_concurrency());
+        if (const char *cap = std::getenv("BFSP_INSERTION_THREADS")) {
+            threads = std::min<size_t>(threads, std::max(1UL, std::strtoul(cap, nullptr, 10)));
+        }
+        return threads;
+    }
+
+    static std::mutex &mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::unique_lock<std::mutex> m_lock;
+};
+
+#endif
@@ -11,8 +11,12 @@ class Parameters {
 
     const std::string &instance_path() const { return m_instance_path; }
     bool verbose() const { return m_verbose; }
+    bool stats() const { return m_stats; }
     bool becnhmark() const { return m_benchmark; }
     std::optional<size_t> seed() const { return m_seed; }
+    std::optional<size_t> evaluations() const { return m_evaluations; }
+    std::optional<size_t> target() const { return m_target; }
+    const std::optional<std::string> &trace() const { return m_trace; }
     std::optional<size_t> tl() const { return m_tl; }
     size_t ro() const { return m_ro; }
     double tP() const { return m_tP; }
@@ -22,8 +26,12 @@ class Parameters {
   private:
     std::string m_instance_path;
     bool m_verbose = false;
+    bool m_stats = false;
     bool m_benchmark = false;
     std::optional<size_t> m_seed;
+    std::optional<size_t> m_evaluations;
+    std::optional<size_t> m_target;
+    std::optional<std::string> m_trace;
     std::optional<size_t> m_tl;
     size_t m_ro = 100;
     double m_tP = 0.5;
@@ -12,9 +12,11 @@
 #include "Core.h"
 #include "Instance.h"
 #include "Log.h"
+#include "constructions/Bidirectional.h"
 #include "constructions/NEH.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 namespace {
 size_t uptime() {
@@ -88,8 +90,14 @@ Solution IG_IJ::solve() {
     size_t n = m_instance.num_jobs();
     size_t lambda = n > 200 ? 20 : n; // setting PFT-NEH parameter
 
-    PF_NEH pf_neh(m_instance);
-    Solution current = pf_neh.solve(lambda);
+    Solution current;
+    {
+        STATS_TIME(Initial);
+        current = bidirectional_construction(m_instance, m_instance_reverse, [lambda](Instance &instance) {
+            PF_NEH pf_neh(instance);
+            return pf_neh.solve(lambda);
+        });
+    }
     Solution best = current;
     Solution incumbent = current;
     std::vector<size_t> reference = current.sequence;
@@ -119,15 +127,23 @@ Solution IG_IJ::solve() {
     double jP = m_params.jP();
 
     while (true) {
+        STATS_COUNT(Iteration);
+
         // DestructConstruct Perturbation
         std::vector<size_t> removed = destroy(incumbent);
-        neh.second_step(std::move(removed), incumbent); // Construct phase
+        {
+            STATS_TIME(Construction);
+            neh.second_step(removed, incumbent); // Construct phase
+        }
 
         // Local Search
-        if(RNG::instance().generate_real_number(0, 1) < jP)
-            BestSwap(incumbent);
-        else{
-            rls(incumbent, reference, m_instance);
+        {
+            STATS_TIME(LocalSearch);
+            if(RNG::instance().generate_real_number(0, 1) < jP)
+                BestSwap(incumbent);
+            else{
+                rls(incumbent, reference, m_instance);
+            }
         }
 
         if (!ro.empty() && uptime() >= (ro.back() * mxn)) {
@@ -136,9 +152,10 @@ Solution IG_IJ::solve() {
         }
 
         //  Program should not accept any solution if the time is out
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best.cost, incumbent.cost))) {
             break;
         }
+        STATS_TIME(Acceptance);
         if (incumbent.cost < current.cost) {
             current = incumbent;
 
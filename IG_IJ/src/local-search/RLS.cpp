@@ -2,6 +2,7 @@
 #include "Core.h"
 #include "Instance.h"
 #include "Solution.h"
+#include "Stats.h"
 #include "constructions/NEH.h"
 
 #include <cassert>
@@ -143,6 +144,7 @@ std::vector<std::pair<size_t, size_t>> grabowski_reinsertion(const Instance &ins
 } // namespace
 
 bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    STATS_COUNT(RlsCall);
     bool improved = false;
     size_t j = 0;
     size_t cnt = 0;
@@ -150,6 +152,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
     core::recalculate_solution(instance, s); // Set departure times matrix
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
 
@@ -169,6 +172,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
         if (makespan < s.cost) {
             s.sequence.insert(s.sequence.begin() + (long)best_index, job);
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             core::recalculate_solution(instance, s);
@@ -184,6 +188,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
 }
 
 bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    STATS_COUNT(RlsCall);
 
     bool improved = false;
     size_t j = 0;
@@ -191,6 +196,7 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
     NEH helper(instance);
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
         for (size_t i = 0; i < s.sequence.size(); i++) {
@@ -204,6 +210,7 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
 
         if (makespan < s.cost) {
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             continue;
@@ -7,14 +7,17 @@
 #include "Parameters.h"
 #include "Solution.h"
 
+#include <random>
+
 class IG_RIS {
   public:
     IG_RIS(Instance instance, Parameters params);
     Solution solve();
 
   private:
-    // Random destroy solution using the parameter d defined on the params struct
-    std::vector<size_t> destroy(Solution &s);
+    // Random destroy solution using the parameter d defined on the params struct, drawing positions from gen. The
+    // removed jobs go to removed, which is cleared first
+    void destroy(Solution &s, std::vector<size_t> &removed, std::mt19937 &gen);
 
     // Constant Temperature to calculate acceptance criterion
     double acceptance_criterion_temperature();
@@ -1,7 +1,9 @@
 #ifndef INSTANCE_H
 #define INSTANCE_H
 
+#include <cstddef>
 #include <filesystem>
+#include <memory>
 #include <vector>
 
 struct Instance {
@@ -13,19 +15,32 @@ struct Instance {
     const std::vector<size_t> &processing_times_sum() const { return m_processing_times_sum; }
     size_t all_processing_times_sum() const { return m_all_processing_times_sum; }
 
-    long p(size_t i, size_t j) const { return m_matrix[i][j]; }
+    // The machine index is mapped through the view orientation, so a reversed view reads the
+    // shared matrix from the last machine to the first without copying it
+    long p(size_t i, size_t j) const {
+        return (m_matrix.get() + i * m_num_machines)[m_first_machine + (std::ptrdiff_t)j * m_machine_step];
+    }
     // Reverse matrix
-    long rp(size_t i, size_t j) const { return m_matrix[i][m_num_machines - j - 1]; }
+    long rp(size_t i, size_t j) const { return p(i, m_num_machines - j - 1); }
 
-    Instance create_reverse_instance();
+    bool is_reversed() const { return m_machine_step < 0; }
+
+    // Zero-copy view of the reverse problem (machines visited in reverse order), the processing
+    // times matrix is shared between both instances
+    Instance create_reverse_instance() const;
 
   private:
     size_t m_num_jobs = 0;
     size_t m_num_machines = 0;
-    std::vector<std::vector<long>> m_matrix;
+    // Row-major, owned or a view into a memory-mapped binary instance
+    std::shared_ptr<const long> m_matrix;
+    std::ptrdiff_t m_first_machine = 0;
+    std::ptrdiff_t m_machine_step = 1;
     std::vector<size_t> m_processing_times_sum;
     size_t m_all_processing_times_sum;
 
+    void parse_text(const std::filesystem::path &path);
+    void load_binary(const std::filesystem::path &path);
     void calculate_processing_times_sum();
     void calculate_all_processing_times_sum();
 };
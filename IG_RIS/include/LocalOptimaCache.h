@@ -0,0 +1,89 @@
+#ifndef LOCAL_OPTIMA_CACHE_H
+#define LOCAL_OPTIMA_CACHE_H
+
+#include "Solution.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Local optimum (and its makespan) that each constructed sequence led to, so a sequence rebuilt by destroy/construct
+// skips the local search. Only valid while the local search is a deterministic function of the sequence, e.g. the
+// reference of rls must not change. Direct-mapped on a Zobrist hash of the sequence, a new entry evicts whatever
+// shared its slot. Only the 64 bit hash is compared, a false hit is negligible next to the number of lookups.
+// find() may be called from several threads at once as long as nothing is inserted meanwhile
+class LocalOptimaCache {
+  public:
+    // capacity is rounded down to a power of two, 0 disables the cache
+    LocalOptimaCache(size_t capacity) {
+        size_t slots = 1;
+        while (slots * 2 <= capacity) {
+            slots *= 2;
+        }
+        m_entries.resize(capacity == 0 ? 0 : slots);
+    }
+
+    // XOR of a key per (position, job). The keys are mixed from the pair instead of drawn from RNG, so the table costs
+    // no memory and enabling the cache does not change the random stream
+    static std::uint64_t hash(const std::vector<size_t> &sequence) {
+        std::uint64_t h = 0;
+        for (size_t i = 0; i < sequence.size(); i++) {
+            h ^= mix((static_cast<std::uint64_t>(i) << 32) | sequence[i]);
+        }
+        return h;
+    }
+
+    // Replaces the sequence and cost of s with the cached local optimum for key, if there is one
+    bool find(std::uint64_t key, Solution &s) {
+        if (m_entries.empty()) {
+            return false;
+        }
+        m_lookups.fetch_add(1, std::memory_order_relaxed);
+
+        const Entry &entry = m_entries[key & (m_entries.size() - 1)];
+        if (entry.sequence.empty() || entry.key != key) {
+            return false;
+        }
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+
+        s.sequence = entry.sequence;
+        s.cost = entry.cost;
+        return true;
+    }
+
+    void insert(std::uint64_t key, const Solution &s) {
+        if (m_entries.empty()) {
+            return;
+        }
+
+        Entry &entry = m_entries[key & (m_entries.size() - 1)];
+        entry.key = key;
+        entry.cost = s.cost;
+        entry.sequence = s.sequence;
+    }
+
+    size_t hits() const { return m_hits.load(); }
+    size_t lookups() const { return m_lookups.load(); }
+
+  private:
+    struct Entry {
+        std::uint64_t key = 0;
+        size_t cost = 0;
+        std::vector<size_t> sequence;
+    };
+
+    // splitmix64 finalizer
+    static std::uint64_t mix(std::uint64_t x) {
+        x += 0x9e3779b97f4a7c15;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+        return x ^ (x >> 31);
+    }
+
+    std::vector<Entry> m_entries;
+    std::atomic<size_t> m_hits{0};
+    std::atomic<size_t> m_lookups{0};
+};
+
+#endif
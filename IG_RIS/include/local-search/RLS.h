@@ -4,9 +4,35 @@
 #include <vector>
 
 #include "Instance.h"
+#include "Parallel.h"
 #include "Solution.h"
+#include "constructions/NEH.h"
 
 bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance);
+// Same as above with a helper owned by the caller, for callers that run it on every iteration
+bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance, NEH &helper);
 bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instance);
 
+// Worker pool and per worker buffers of rls_speculative, kept by the caller so a call does not allocate
+struct SpeculativeRls {
+    struct Move {
+        size_t job;
+        size_t og_index;
+        size_t best_index;
+        size_t makespan;
+    };
+
+    SpeculativeRls(Instance &instance, size_t num_workers);
+
+    WorkerPool pool;
+    std::vector<NEH> helpers;
+    std::vector<std::vector<size_t>> sequences;
+    std::vector<Move> moves;
+};
+
+// Same moves and local optimum as rls, but the reinsertions of the next pool.size() jobs of ref are evaluated at once
+// against the current sequence. They are applied in ref order up to the first one that moves its job, the makespan is
+// a property of the whole sequence so every evaluation after it is stale and gets redone in the next round
+bool rls_speculative(Solution &s, const std::vector<size_t> &ref, Instance &instance, SpeculativeRls &state);
+
 #endif
\ No newline at end of file
@@ -4,17 +4,24 @@
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <ostream>
+#include <random>
 #include <vector>
 
 #include "Core.h"
 #include "Instance.h"
+#include "LocalOptimaCache.h"
 #include "Log.h"
+#include "Parallel.h"
+#include "constructions/Bidirectional.h"
 #include "constructions/NEH.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 namespace {
 size_t uptime() {
@@ -44,8 +51,14 @@ Solution IG_RIS::solve() {
 
     size_t n = m_instance.num_jobs();
     size_t lambda = n > 200 ? 20 : n; // setting PF-NEH parameter
-    PF_NEH pf_neh(m_instance);
-    Solution current = pf_neh.solve(lambda);
+    Solution current;
+    {
+        STATS_TIME(Initial);
+        current = bidirectional_construction(m_instance, m_instance_reverse, [lambda](Instance &instance) {
+            PF_NEH pf_neh(instance);
+            return pf_neh.solve(lambda);
+        });
+    }
     Solution best = current;
     Solution incumbent = current;
     std::vector<size_t> reference = current.sequence;
@@ -69,58 +82,111 @@ Solution IG_RIS::solve() {
     }
 
     VERBOSE(m_params.verbose()) << "Time limit: " << time_limit << "s\n";
-    NEH neh(m_instance);
+    // The reference of rls never changes, so the local optimum only depends on the constructed sequence
+    LocalOptimaCache cache(m_params.cache());
+
+    // Every iteration builds one candidate per worker from current, worker 0 keeps the global random stream so a
+    // single worker behaves exactly as the serial algorithm
+    WorkerPool pool(m_params.workers());
+    std::vector<std::mt19937> generators;
+    for (size_t w = 1; w < pool.size(); w++) {
+        generators.emplace_back(RNG::instance().gen()());
+    }
+    // The rls of each candidate worker gets a pool of its own when it runs speculatively
+    std::vector<std::unique_ptr<SpeculativeRls>> rls_pools;
+    if (m_params.rls_workers() > 1) {
+        for (size_t w = 0; w < pool.size(); w++) {
+            rls_pools.push_back(std::make_unique<SpeculativeRls>(m_instance, m_params.rls_workers()));
+        }
+    }
+    // Per worker buffers, reused by every iteration
+    std::vector<NEH> helpers(pool.size(), NEH(m_instance));
+    std::vector<Solution> candidates(pool.size());
+    std::vector<std::vector<size_t>> removed(pool.size());
+    std::vector<std::uint64_t> keys(pool.size());
+    std::vector<char> hits(pool.size());
 
     while (true) {
-        // DestructConstruct Perturbation
-        std::vector<size_t> removed = destroy(incumbent);
-        neh.second_step(std::move(removed), incumbent); // Construct phase
+        STATS_COUNT(Iteration);
+
+        pool.run([&](size_t w) {
+            Solution &candidate = candidates[w];
+            candidate = current;
+
+            // DestructConstruct Perturbation
+            destroy(candidate, removed[w], w == 0 ? RNG::instance().gen() : generators[w - 1]);
+            {
+                STATS_TIME(Construction);
+                helpers[w].second_step(removed[w], candidate); // Construct phase
+            }
+
+            // local search
+            STATS_TIME(LocalSearch);
+            keys[w] = LocalOptimaCache::hash(candidate.sequence);
+            hits[w] = cache.find(keys[w], candidate);
+            if (!hits[w]) {
+                if (rls_pools.empty()) {
+                    rls(candidate, reference, m_instance, helpers[w]);
+                } else {
+                    rls_speculative(candidate, reference, m_instance, *rls_pools[w]);
+                }
+            }
+        });
+
+        // Lowest makespan wins, ties go to the lowest worker so the outcome does not depend on the schedule
+        size_t chosen = 0;
+        for (size_t w = 0; w < pool.size(); w++) {
+            if (!hits[w]) {
+                cache.insert(keys[w], candidates[w]);
+            }
+            if (candidates[w].cost < candidates[chosen].cost) {
+                chosen = w;
+            }
+        }
+        std::swap(incumbent, candidates[chosen]);
 
-        // local search
-        rls(incumbent, reference, m_instance);
-        
         if (!ro.empty() && uptime() >= (ro.back() * mxn)) {
             std::cout << best.cost << '\n';
             ro.pop_back();
         }
 
         //  Program should not accept any solution if the time is out
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best.cost, incumbent.cost))) {
             break;
         }
+        STATS_TIME(Acceptance);
         if (incumbent.cost < current.cost) {
             current = incumbent;
 
             if(incumbent.cost < best.cost){
                 VERBOSE(m_params.verbose()) << "Found a new best\n";
                 VERBOSE(m_params.verbose()) << incumbent;
-                best = current = std::move(incumbent);
+                best = current;
             }
         }
         // If the solution is worse than the best it's accepted 50% of the times
         else if (RNG::instance().generate_real_number(0, 1) < acceptance_criterion(incumbent, current)) {
-            current = std::move(incumbent);
+            std::swap(current, incumbent);
         }
-
-        incumbent = current;
     }
 
+    VERBOSE(m_params.verbose()) << "Local optima cache hits: " << cache.hits() << " out of " << cache.lookups() << '\n';
+
     return best;
 }
 
-std::vector<size_t> IG_RIS::destroy(Solution &s) {
+void IG_RIS::destroy(Solution &s, std::vector<size_t> &removed, std::mt19937 &gen) {
+    STATS_TIME(Destruction);
 
     // This mostly avoids crashes on really small toy instances
     const size_t destroy_size = std::min(s.sequence.size() - 1, m_params.d());
 
-    std::vector<size_t> removed;
-    removed.reserve(destroy_size);
+    removed.clear();
     // Random remove d nodes
     for (size_t i = 0; i < destroy_size; i++) {
-        const long chose = RNG::instance().generate<long>(0, ((long)s.sequence.size()) - 1);
+        std::uniform_int_distribution<long> dis(0, ((long)s.sequence.size()) - 1);
+        const long chose = dis(gen);
         removed.push_back(s.sequence[chose]);
         s.sequence.erase(s.sequence.begin() + chose);
     }
-
-    return removed;
 }
@@ -1,11 +1,13 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "Core.h"
 #include "IG_RIS.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -16,8 +18,30 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"IG_RIS", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
+    const bool print_stats = params.stats();
+
     IG_RIS ig_ris(std::move(instance), std::move(params));
     const Solution best = ig_ris.solve();
 
     std::cout << best.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(best.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 }
@@ -11,22 +11,36 @@ class Parameters {
 
     const std::string &instance_path() const { return m_instance_path; }
     bool verbose() const { return m_verbose; }
+    bool stats() const { return m_stats; }
     bool becnhmark() const { return m_benchmark; }
     std::optional<size_t> seed() const { return m_seed; }
+    std::optional<size_t> evaluations() const { return m_evaluations; }
+    std::optional<size_t> target() const { return m_target; }
+    const std::optional<std::string> &trace() const { return m_trace; }
     std::optional<size_t> tl() const { return m_tl; }
     size_t ro() const { return m_ro; }
     double tP() const { return m_tP; }
     size_t d() const { return m_dS; }
+    size_t cache() const { return m_cache; }
+    size_t workers() const { return m_workers; }
+    size_t rls_workers() const { return m_rls_workers; }
 
   private:
     std::string m_instance_path;
     bool m_verbose = false;
+    bool m_stats = false;
     bool m_benchmark = false;
     std::optional<size_t> m_seed;
+    std::optional<size_t> m_evaluations;
+    std::optional<size_t> m_target;
+    std::optional<std::string> m_trace;
     std::optional<size_t> m_tl;
     size_t m_ro = 100;
     double m_tP = 0.5;
     size_t m_dS = 8;
+    size_t m_cache = 1024;
+    size_t m_workers = 1;
+    size_t m_rls_workers = 1;
 };
 
 #endif
\ No newline at end of file
@@ -3,10 +3,12 @@
 #include <iostream>
 #include <numeric>
 
+#include "Core.h"
 #include "Solution.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 #include "IG_VND1.h"
 
 int main(int argc, char *argv[]) {
@@ -17,10 +19,32 @@ int main(int argc, char *argv[]) {
     if (auto seed = params.seed()) {
         RNG::instance().set_seed(*seed);
     }
+
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"IG_VND1", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
     
+    const bool print_stats = params.stats();
+
     IG_VND1 ig_vnd1(std::move(instance), std::move(params));
     const Solution best = ig_vnd1.solve();
 
     std::cout << best.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(best.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
     
 }
@@ -7,14 +7,17 @@
 #include "Parameters.h"
 #include "Solution.h"
 
+#include <random>
+
 class IG_VND2 {
   public:
     IG_VND2(Instance instance, Parameters params);
     Solution solve();
 
   private:
-    // Random destroy solution using the parameter d defined on the params struct
-    std::vector<size_t> destroy(Solution &s);
+    // Random destroy solution using the parameter d defined on the params struct, drawing positions from gen. The
+    // removed jobs go to removed, which is cleared first
+    void destroy(Solution &s, std::vector<size_t> &removed, std::mt19937 &gen);
 
     // Constant Temperature to calculate acceptance criterion
     double acceptance_criterion_temperature()
@@ -23,8 +26,8 @@ class IG_VND2 {
     // Calculate acceptance criterion to worse solution
     double acceptance_criterion(Solution&, Solution&);
 
-    // Apply Best Swap
-    void BestSwap(Solution &solution);
+    // Apply Best Swap, copy is scratch space that keeps its buffers between calls
+    void BestSwap(Solution &solution, Solution &copy);
 
     // These classes are "imutable" all their members are private and there is no "set" method for those members
     // almost like a read only memory
@@ -2,6 +2,7 @@
 #define NEH_H
 
 #include "Instance.h"
+#include "Parallel.h"
 #include "Solution.h"
 
 class NEH {
@@ -20,11 +21,14 @@ class NEH {
     std::pair<size_t, size_t> taillard_grabowski_best_ins(const Solution &s, size_t k,
                                                           const std::vector<std::pair<size_t, size_t>> &ranges);
 
-    void second_step(std::vector<size_t> phi, Solution &s);
+    void second_step(const std::vector<size_t> &phi, Solution &s);
 
   private:
     size_t insert_calculation(size_t i, size_t k, size_t best_value);
 
+    // Positions 1..size of taillard_best_insertion split among the workers of pool, with the same result
+    std::pair<size_t, size_t> parallel_insertion_scan(WorkerPool &pool, size_t k, size_t size, size_t best_value);
+
     Instance &m_instance;
 
     // TaillarDS (TDS) matrices
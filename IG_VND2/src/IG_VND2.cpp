@@ -6,15 +6,20 @@
 #include <cstddef>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <ostream>
+#include <random>
 #include <vector>
 
 #include "Core.h"
 #include "Instance.h"
 #include "Log.h"
+#include "Parallel.h"
+#include "constructions/Bidirectional.h"
 #include "constructions/NEH.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 namespace {
 size_t uptime() {
@@ -37,9 +42,9 @@ double IG_VND2::acceptance_criterion(Solution& pi_0, Solution& pi_2) {
     return std::exp(-delta/m_T);
 }
 
-void IG_VND2::BestSwap(Solution &solution) { // NOLINT
+void IG_VND2::BestSwap(Solution &solution, Solution &copy) { // NOLINT
     // starting variables
-    Solution copy = solution;
+    copy = solution;
     size_t original_cost = solution.cost;
     size_t best_j = 0;
     size_t best_i = 0;
@@ -88,8 +93,14 @@ Solution IG_VND2::solve() {
     size_t n = m_instance.num_jobs();
     size_t lambda = n > 200 ? 20 : n; // setting PF-NEH parameter
 
-    PFT_NEH pft_neh(m_instance);
-    Solution current = pft_neh.solve(lambda);
+    Solution current;
+    {
+        STATS_TIME(Initial);
+        current = bidirectional_construction(m_instance, m_instance_reverse, [lambda](Instance &instance) {
+            PFT_NEH pft_neh(instance);
+            return pft_neh.solve(lambda);
+        });
+    }
     Solution best = current;
     Solution incumbent = current;
     std::vector<size_t> reference = current.sequence;
@@ -113,35 +124,79 @@ Solution IG_VND2::solve() {
     }
 
     VERBOSE(m_params.verbose()) << "Time limit: " << time_limit << "s\n";
-    NEH neh(m_instance);
+    // Every iteration builds one candidate per worker from current, worker 0 keeps the global random stream so a
+    // single worker behaves exactly as the serial algorithm
+    WorkerPool pool(m_params.workers());
+    std::vector<std::mt19937> generators;
+    for (size_t w = 1; w < pool.size(); w++) {
+        generators.emplace_back(RNG::instance().gen()());
+    }
+    // The rls of each candidate worker gets a pool of its own when it runs speculatively
+    std::vector<std::unique_ptr<SpeculativeRls>> rls_pools;
+    if (m_params.rls_workers() > 1) {
+        for (size_t w = 0; w < pool.size(); w++) {
+            rls_pools.push_back(std::make_unique<SpeculativeRls>(m_instance, m_params.rls_workers()));
+        }
+    }
+    // Per worker buffers, reused by every iteration
+    std::vector<NEH> helpers(pool.size(), NEH(m_instance));
+    std::vector<Solution> candidates(pool.size());
+    std::vector<std::vector<size_t>> removed(pool.size());
+    std::vector<Solution> temporals(pool.size());
+    std::vector<Solution> copies(pool.size());
 
     while (true) {
-        size_t k_max = 2;
-        size_t k = 1;
+        STATS_COUNT(Iteration);
 
-        // DestructConstruct Perturbation
-        std::vector<size_t> removed = destroy(incumbent);
-        neh.second_step(std::move(removed), incumbent); // Construct phase
+        pool.run([&](size_t w) {
+            size_t k_max = 2;
+            size_t k = 1;
 
-        // VND Local Search
-        Solution temporal = incumbent;
+            Solution &candidate = candidates[w];
+            candidate = current;
 
-        while(k <= k_max) {
-            if(k == 1)
-                BestSwap(incumbent);
-            else if(k == 2)
-                rls(incumbent, reference, m_instance);
+            // DestructConstruct Perturbation
+            destroy(candidate, removed[w], w == 0 ? RNG::instance().gen() : generators[w - 1]);
+            {
+                STATS_TIME(Construction);
+                helpers[w].second_step(removed[w], candidate); // Construct phase
+            }
 
-            if(incumbent.cost < temporal.cost){
-                temporal = incumbent;
-                k = 1;
+            // VND Local Search
+            STATS_TIME(LocalSearch);
+            Solution &temporal = temporals[w];
+            temporal = candidate;
+
+            while(k <= k_max) {
+                if(k == 1)
+                    BestSwap(candidate, copies[w]);
+                else if(k == 2) {
+                    if (rls_pools.empty())
+                        rls(candidate, reference, m_instance, helpers[w]);
+                    else
+                        rls_speculative(candidate, reference, m_instance, *rls_pools[w]);
+                }
+
+                if(candidate.cost < temporal.cost){
+                    temporal = candidate;
+                    k = 1;
+                }
+                else {
+                    k += 1;
+                }
             }
-            else {
-                k += 1;
+
+            std::swap(candidate, temporal);
+        });
+
+        // Lowest makespan wins, ties go to the lowest worker so the outcome does not depend on the schedule
+        size_t chosen = 0;
+        for (size_t w = 1; w < pool.size(); w++) {
+            if (candidates[w].cost < candidates[chosen].cost) {
+                chosen = w;
             }
         }
-
-        incumbent = temporal;
+        std::swap(incumbent, candidates[chosen]);
 
         if (!ro.empty() && uptime() >= (ro.back() * mxn) / 1000) {
 
@@ -150,43 +205,39 @@ Solution IG_VND2::solve() {
         }
         
         //  Program should not accept any solution if the time is out
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best.cost, incumbent.cost))) {
             break;
         }
+        STATS_TIME(Acceptance);
         if (incumbent.cost < current.cost) {
             current = incumbent;
 
             if(incumbent.cost < best.cost){
                 VERBOSE(m_params.verbose()) << "Found a new best\n";
                 VERBOSE(m_params.verbose()) << incumbent;
-                best = current = std::move(incumbent);
+                best = current;
             }
         }
         // If the solution is worse than the best it's accepted according to the acceptance criterion
         else if (RNG::instance().generate_real_number(0, 1) < acceptance_criterion(incumbent, current)) {
-            current = std::move(incumbent);
+            std::swap(current, incumbent);
         }
-
-        // Updating incubent for next interation
-        incumbent = current;
     }
 
     return best;
 }
 
-std::vector<size_t> IG_VND2::destroy(Solution &s) {
+void IG_VND2::destroy(Solution &s, std::vector<size_t> &removed, std::mt19937 &gen) {
 
     // This mostly avoids crashes on really small toy instances
     const size_t destroy_size = std::min(s.sequence.size() - 1, m_params.d());
 
-    std::vector<size_t> removed;
-    removed.reserve(destroy_size);
+    removed.clear();
     // Random remove d nodes
     for (size_t i = 0; i < destroy_size; i++) {
-        const long chose = RNG::instance().generate<long>(0, ((long)s.sequence.size()) - 1);
+        std::uniform_int_distribution<long> dis(0, ((long)s.sequence.size()) - 1);
+        const long chose = dis(gen);
         removed.push_back(s.sequence[chose]);
         s.sequence.erase(s.sequence.begin() + chose);
     }
-
-    return removed;
 }
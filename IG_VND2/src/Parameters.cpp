@@ -1,6 +1,10 @@
 #include "Parameters.h"
 
+#include "Core.h"
 #include "argparse/argparse.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
 
 namespace {
 void config_argparse(argparse::ArgumentParser &cli) {
@@ -11,6 +15,28 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .help("set random number generator seed")
         .metavar("SEED")
         .scan<'i', size_t>();
+
+    cli.add_argument("--evaluations")
+        .help("stop once this many makespan evaluations are spent instead of on the time limit, the step running "
+              "then finishes first so the count reported at the end may be a bit higher")
+        .metavar("EVALUATIONS")
+        .scan<'i', size_t>();
+    cli.add_argument("--target")
+        .help("stop as soon as a solution with at most this makespan is found")
+        .metavar("MAKESPAN")
+        .scan<'i', size_t>();
+    cli.add_argument("--trace")
+        .help("write every improvement of the best solution to this file, as JSON if it ends in .json or CSV")
+        .metavar("PATH");
+    cli.add_argument("--print-isa")
+        .help("print the instruction set the hot kernels were dispatched to and exit")
+        .action([](const std::string &) {
+            std::cout << core::selected_isa() << '\n';
+            std::exit(0);
+        })
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
     
         cli.add_argument("-t", "--time")
         .help("set the time limit for the program")
@@ -29,6 +55,11 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .default_value(false)
         .flag();
 
+    cli.add_argument("--stats")
+        .help("print the hot-path counters and phase times to stderr at exit")
+        .default_value(false)
+        .flag();
+
     cli.add_argument("-r", "--ro")
         .help("set the ro parameter which delimits the time limit of the program")
         .metavar("RO")
@@ -46,6 +77,20 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .metavar("DESTROY")
         .default_value(size_t(8))
         .scan<'i', size_t>();
+
+    cli.add_argument("--workers")
+        .help("number of destroy/construct/local search candidates built in parallel on each iteration, the best one "
+              "goes through the acceptance criterion")
+        .metavar("WORKERS")
+        .default_value(size_t(1))
+        .scan<'i', size_t>();
+
+    cli.add_argument("--rls-workers")
+        .help("number of rls reinsertions evaluated at once against the same sequence, only the ones up to the first "
+              "move are kept so the local optimum does not change")
+        .metavar("WORKERS")
+        .default_value(size_t(1))
+        .scan<'i', size_t>();
 }
 } // namespace
 
@@ -67,10 +112,16 @@ Parameters::Parameters(int argc, char **argv) {
     // Set members
     m_instance_path = cli.get<std::string>("instance");
     m_verbose = cli.get<bool>("--verbose");
+    m_stats = cli.get<bool>("--stats");
     m_benchmark = cli.get<bool>("--benchmark");
     m_seed = cli.present<size_t>("--seed");
+    m_evaluations = cli.present<size_t>("--evaluations");
+    m_target = cli.present<size_t>("--target");
+    m_trace = cli.present<std::string>("--trace");
     m_tl = cli.present<size_t>("--time");
     m_ro = cli.get<size_t>("--ro");
     m_tP = cli.get<double>("--temperature");
     m_dS = cli.get<size_t>("--destroy");
+    m_workers = std::max<size_t>(1, cli.get<size_t>("--workers"));
+    m_rls_workers = std::max<size_t>(1, cli.get<size_t>("--rls-workers"));
 }
\ No newline at end of file
@@ -0,0 +1,20 @@
+#include "constructions/Bidirectional.h"
+#include "Core.h"
+
+#include <algorithm>
+#include <future>
+#include <utility>
+
+Solution bidirectional_construction(Instance &instance, Instance &reverse_instance,
+                                    const std::function<Solution(Instance &)> &construction) {
+
+    // Both directions only read the shared instance data, so they can be built at the same time
+    std::future<Solution> reverse_future = std::async(std::launch::async, construction, std::ref(reverse_instance));
+    Solution normal = construction(instance);
+    Solution reversed = reverse_future.get();
+
+    std::reverse(reversed.sequence.begin(), reversed.sequence.end());
+    core::recalculate_solution(instance, reversed);
+
+    return normal.cost <= reversed.cost ? std::move(normal) : std::move(reversed);
+}
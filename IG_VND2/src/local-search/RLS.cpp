@@ -1,12 +1,16 @@
 #include "local-search/RLS.h"
 #include "Core.h"
 #include "Instance.h"
+#include "Parallel.h"
 #include "Solution.h"
+#include "Stats.h"
 #include "constructions/NEH.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <stack>
+#include <tuple>
 #include <vector>
 
 #include <iostream>
@@ -143,6 +147,7 @@ std::vector<std::pair<size_t, size_t>> grabowski_reinsertion(const Instance &ins
 } // namespace
 
 bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    STATS_COUNT(RlsCall);
     bool improved = false;
     size_t j = 0;
     size_t cnt = 0;
@@ -150,6 +155,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
     core::recalculate_solution(instance, s); // Set departure times matrix
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
 
@@ -169,6 +175,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
         if (makespan < s.cost) {
             s.sequence.insert(s.sequence.begin() + (long)best_index, job);
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             core::recalculate_solution(instance, s);
@@ -184,13 +191,19 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
 }
 
 bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    NEH helper(instance);
+    return rls(s, ref, instance, helper);
+}
+
+bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance, NEH &helper) {
+    STATS_COUNT(RlsCall);
 
     bool improved = false;
     size_t j = 0;
     size_t cnt = 0;
-    NEH helper(instance);
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
         for (size_t i = 0; i < s.sequence.size(); i++) {
@@ -204,6 +217,7 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
 
         if (makespan < s.cost) {
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             continue;
@@ -213,4 +227,64 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
     }
 
     return improved;
-}
\ No newline at end of file
+}
+
+SpeculativeRls::SpeculativeRls(Instance &instance, size_t num_workers)
+    : pool(num_workers), helpers(std::min(pool.size(), instance.num_jobs()), NEH(instance)),
+      sequences(helpers.size()), moves(helpers.size()) {}
+
+bool rls_speculative(Solution &s, const std::vector<size_t> &ref, Instance &instance, SpeculativeRls &state) {
+    STATS_COUNT(RlsCall);
+
+    const size_t n = instance.num_jobs();
+    const size_t batch = state.helpers.size();
+
+    bool improved = false;
+    size_t j = 0;
+    size_t cnt = 0;
+    while (cnt < n) {
+        // The next jobs of ref are all reinserted against the same sequence
+        state.pool.run([&](size_t w) {
+            if (w >= batch) {
+                return;
+            }
+
+            SpeculativeRls::Move &move = state.moves[w];
+            move.job = ref[(j + 1 + w) % n];
+
+            std::vector<size_t> &sequence = state.sequences[w];
+            sequence = s.sequence;
+            move.og_index = std::find(sequence.begin(), sequence.end(), move.job) - sequence.begin();
+            sequence.erase(sequence.begin() + (long)move.og_index);
+
+            std::tie(move.best_index, move.makespan) = state.helpers[w].taillard_best_insertion(sequence, move.job);
+        });
+
+        // Applied in ref order, once the sequence changes the remaining moves are stale and get evaluated again
+        for (const SpeculativeRls::Move &move : state.moves) {
+            j = (j + 1) % n;
+            STATS_COUNT(RlsStep);
+
+            const bool changed = move.best_index != move.og_index;
+            if (changed) {
+                s.sequence.erase(s.sequence.begin() + (long)move.og_index);
+                s.sequence.insert(s.sequence.begin() + (long)move.best_index, move.job);
+            }
+
+            if (move.makespan < s.cost) {
+                cnt = 0;
+                STATS_COUNT(RlsImprovement);
+                s.cost = move.makespan;
+                improved = true;
+            } else {
+                cnt++;
+            }
+
+            if (changed || cnt >= n) {
+                break;
+            }
+        }
+    }
+
+    return improved;
+}
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <limits>
 
+#include "Stats.h"
+
 namespace {
 size_t uptime() {
     static const auto global_start_time = std::chrono::steady_clock::now();
@@ -23,6 +25,7 @@ MA::MA(Instance instance, Parameters params) : m_instance(std::move(instance)),
 }
 
 void MA::initialize_population() {
+    STATS_TIME(Initial);
 
     const size_t n = m_instance.num_jobs();
     const size_t lambda = n > LAMBDA_MAX ? LAMBDA_MAX : n; // setting PF-NEH parameter
@@ -37,7 +40,7 @@ void MA::initialize_population() {
     for (size_t i = 1; i < m_params.ps(); i++) {
 
         m_pop[i].sequence = generate_random_sequence();
-        core::recalculate_solution(m_instance, m_pop[i]);
+        core::calculate_cost(m_instance, m_pop[i]);
     }
 }
 
@@ -166,6 +169,7 @@ bool MA::equal_solution(Solution &s1, Solution &s2) {
 }
 
 void MA::population_updating(std::vector<Solution> &offspring_population) {
+    STATS_TIME(Selection);
 
     const size_t c = std::numeric_limits<size_t>::max();
 
@@ -189,8 +193,9 @@ void MA::population_updating(std::vector<Solution> &offspring_population) {
         }
 
         if (!already_exist && replaced_individual != c) {
-            m_pop.insert(m_pop.begin() + replaced_individual, i);
-            m_pop.pop_back();
+            // Copied over the worst individual to reuse its buffers, the rotation only swaps vector handles
+            m_pop.back() = i;
+            std::rotate(m_pop.begin() + (long)replaced_individual, m_pop.end() - 1, m_pop.end());
         }
     }
 }
@@ -208,10 +213,10 @@ void MA::restart_population() {
         if (i < m_pop.size() / 2) {
             mutation(m_pop[i]);
             mutation(m_pop[i]);
-            core::recalculate_solution(m_instance, m_pop[i]);
+            core::calculate_cost(m_instance, m_pop[i]);
         } else {
             m_pop[i].sequence = generate_random_sequence();
-            core::recalculate_solution(m_instance, m_pop[i]);
+            core::calculate_cost(m_instance, m_pop[i]);
         }
     }
 }
@@ -241,10 +246,16 @@ Solution MA::solve() { // NOLINT
 
     size_t count = 0;
     while (true) {
+        STATS_COUNT(Iteration);
 
         std::vector<Solution> offspring_population;
 
         while (offspring_population.size() < m_params.ps()) {
+            // Every offspring goes through rls, so the budget is also checked for each pair and not only once per
+            // generation
+            if (core::budget_spent()) {
+                break;
+            }
 
             const size_t parent_1 = selection();
             size_t parent_2 = parent_1;
@@ -255,6 +266,7 @@ Solution MA::solve() { // NOLINT
             Solution offspring1;
             Solution offspring2;
             if (RNG::instance().generate_real_number(0.0, 1.0) < m_params.pc()) {
+                STATS_TIME(Crossover);
                 offspring1 = path_relink_swap(m_pop[parent_1], m_pop[parent_2]);
                 offspring2 = path_relink_swap(m_pop[parent_2], m_pop[parent_1]);
             } else {
@@ -263,15 +275,18 @@ Solution MA::solve() { // NOLINT
             }
 
             if (RNG::instance().generate_real_number(0.0, 1.0) < m_params.pm()) {
+                STATS_TIME(Mutation);
                 mutation(offspring1);
                 core::recalculate_solution(m_instance, offspring1);
             }
             if (RNG::instance().generate_real_number(0.0, 1.0) < m_params.pm()) {
+                STATS_TIME(Mutation);
                 mutation(offspring2);
                 core::recalculate_solution(m_instance, offspring2);
             }
 
             if (!equal_solution(offspring1, m_pop[parent_1]) && !equal_solution(offspring1, m_pop[parent_2])) {
+                STATS_TIME(LocalSearch);
                 ref = offspring1.sequence;
 
                 if (rls_grabowski(offspring1, ref, m_instance)) {
@@ -281,6 +296,7 @@ Solution MA::solve() { // NOLINT
                 offspring_population.push_back(offspring1);
             }
             if (!equal_solution(offspring2, m_pop[parent_1]) && !equal_solution(offspring2, m_pop[parent_2])) {
+                STATS_TIME(LocalSearch);
                 ref = offspring2.sequence;
 
                 if (rls_grabowski(offspring2, ref, m_instance)) {
@@ -303,7 +319,7 @@ Solution MA::solve() { // NOLINT
             ro.pop_back();
         }
 
-        if (uptime() > m_time_limit) {
+        if (core::should_stop(uptime() > m_time_limit, std::min(best_solution.cost, m_pop[0].cost))) {
             break;
         }
 
@@ -2,11 +2,13 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "Core.h"
 #include "Instance.h"
 #include "Log.h"
 #include "MA.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -17,12 +19,34 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"MA", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
     DEBUG << "Showing normal debug macro\n";
     DEBUG_EXTRA << "Showing extra debug macro\n";
 
     VERBOSE(params.verbose()) << "Showing verbose macro\n";
 
+    const bool print_stats = params.stats();
+
     MA ma = MA(std::move(instance), std::move(params));
     const Solution best = ma.solve();
     std::cout << best.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(best.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 }
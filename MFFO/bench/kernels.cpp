@@ -0,0 +1,154 @@
+// Microbenchmarks for the evaluation kernels. Every kernel is called in batches that double in size until a batch
+// takes at least MIN_SECONDS, then the time per call and the evaluations per second are reported. Run with
+// `meson test --benchmark` or directly as `kernels_bench <instance>...`
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Core.h"
+#include "Instance.h"
+#include "MinMax.h"
+#include "NEH.h"
+#include "RLS.h"
+#include "Solution.h"
+
+namespace {
+constexpr double MIN_SECONDS = 0.2;
+constexpr size_t POOL_SIZE = 16;
+
+// Keeps the compiler from dropping the kernels whose result would otherwise be unused
+volatile size_t g_sink = 0;
+
+template <typename Kernel> double seconds_per_call(Kernel &&kernel) {
+    for (size_t calls = 1;; calls *= 2) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < calls; i++) {
+            g_sink = g_sink + kernel(i);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (elapsed.count() >= MIN_SECONDS) {
+            return elapsed.count() / static_cast<double>(calls);
+        }
+    }
+}
+
+// evals_per_call is how many sequence or insertion evaluations one call does, 0 when it depends on the input
+void report(const std::string &name, double seconds, double evals_per_call) {
+    std::cout << "  " << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << seconds * 1e9 << std::setprecision(0) << std::setw(16) << 1.0 / seconds;
+    if (evals_per_call > 0) {
+        std::cout << std::setw(16) << evals_per_call / seconds;
+    } else {
+        std::cout << std::setw(16) << "-";
+    }
+    std::cout << '\n';
+}
+
+void run(Instance &instance, const std::string &name) {
+    const size_t n = instance.num_jobs();
+    const auto n_evals = static_cast<double>(n);
+
+    // Fixed seed so every run and every build times the same sequences
+    std::mt19937 gen(42);
+    std::vector<Solution> pool(POOL_SIZE);
+    for (auto &s : pool) {
+        s.sequence.resize(n);
+        std::iota(s.sequence.begin(), s.sequence.end(), 0);
+        std::shuffle(s.sequence.begin(), s.sequence.end(), gen);
+        core::recalculate_solution(instance, s);
+    }
+    auto from_pool = [&pool](size_t i) -> const Solution & { return pool[i % POOL_SIZE]; };
+
+    std::cout << name << " (n=" << n << ", m=" << instance.num_machines() << ")\n";
+    std::cout << "  " << std::left << std::setw(32) << "kernel" << std::right << std::setw(14) << "ns/call"
+              << std::setw(16) << "calls/s" << std::setw(16) << "evals/s" << '\n';
+
+    Solution s = pool[0];
+    s.tail = std::vector(n + 1, std::vector<size_t>(instance.num_machines())); // sized like NEH does
+    report("calculate_departure_times", seconds_per_call([&](size_t i) {
+               s.sequence = from_pool(i).sequence;
+               core::calculate_departure_times(instance, s);
+               return s.departure_times[n - 1][instance.num_machines() - 1];
+           }),
+           1);
+
+    report("calculate_makespan", seconds_per_call([&](size_t i) {
+               return core::calculate_makespan(instance, from_pool(i).sequence);
+           }),
+           1);
+
+    report("calculate_tail", seconds_per_call([&](size_t i) {
+               s.sequence = from_pool(i).sequence;
+               core::calculate_tail(instance, s);
+               return s.tail[0][0];
+           }),
+           1);
+
+    report("partial_recalculate_solution", seconds_per_call([&](size_t i) {
+               s.sequence = from_pool(i).sequence;
+               core::partial_recalculate_solution(instance, s, n / 2);
+               return s.cost;
+           }),
+           0.5);
+
+    // Inserting the last job of the sequence back into the other n - 1
+    NEH neh(instance);
+    std::vector<std::vector<size_t>> partial(POOL_SIZE);
+    for (size_t i = 0; i < POOL_SIZE; i++) {
+        partial[i] = {pool[i].sequence.begin(), pool[i].sequence.end() - 1};
+    }
+    report("NEH::taillard_best_insertion", seconds_per_call([&](size_t i) {
+               return neh.taillard_best_insertion(partial[i % POOL_SIZE], pool[i % POOL_SIZE].sequence.back()).second;
+           }),
+           n_evals);
+
+    report("grabowski_reinsertion", seconds_per_call([&](size_t i) {
+               const Solution &sol = from_pool(i);
+               return grabowski_reinsertion(instance, sol, sol.sequence[i % n]).size();
+           }),
+           0);
+
+    // Both local searches start from a random solution every call, the copy is negligible next to them
+    const std::vector<size_t> &ref = pool[0].sequence;
+    report("rls", seconds_per_call([&](size_t i) {
+               s = from_pool(i);
+               rls(s, ref, instance);
+               return s.cost;
+           }),
+           0);
+
+    report("rls_grabowski", seconds_per_call([&](size_t i) {
+               s = from_pool(i);
+               rls_grabowski(s, ref, instance);
+               return s.cost;
+           }),
+           0);
+
+    MinMax mm(instance);
+    report("MinMax::solve", seconds_per_call([&](size_t) { return mm.solve().sequence.front(); }), 0);
+
+    std::cout << '\n';
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <instance>...\n";
+        return EXIT_FAILURE;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        const std::string path = argv[i];
+        Instance instance(path);
+        run(instance, path.substr(path.find_last_of('/') + 1));
+    }
+}
@@ -1,8 +1,8 @@
 #ifndef MINMAX_H
 #define MINMAX_H
 #include "Instance.h"
-#include "Parameters.h"
 #include "Solution.h"
+#include "TransitionMatrix.h"
 
 class MinMax {
   public:
@@ -11,8 +11,9 @@ class MinMax {
     Solution solve();
 
   private:
-    Instance m_instance;
+    Instance &m_instance;
     double m_alpha;
+    TransitionMatrix m_transition;
 };
 
 #endif
@@ -11,17 +11,25 @@ class Parameters {
 
     const std::string &instance_path() const { return m_instance_path; }
     std::optional<size_t> seed() const { return m_seed; }
+    std::optional<size_t> evaluations() const { return m_evaluations; }
+    std::optional<size_t> target() const { return m_target; }
+    const std::optional<std::string> &trace() const { return m_trace; }
     double alpha() const { return m_alpha; }
     double pls() const { return m_pls; }
     size_t ps() const { return m_ps; }
     size_t t() const { return m_T; }
     bool benchmark() const { return m_benchmark; }
+    bool stats() const { return m_stats; }
     size_t ro() const { return m_ro; }
 
   private:
     std::string m_instance_path;
     std::optional<size_t> m_seed;
+    std::optional<size_t> m_evaluations;
+    std::optional<size_t> m_target;
+    std::optional<std::string> m_trace;
     bool m_benchmark = false;
+    bool m_stats = false;
     size_t m_ro = 30;
     double m_alpha = 0.6;
     double m_pls = 0.6; // The heuristic presents its best performance with φ = 0.75
@@ -1,6 +1,7 @@
 #ifndef RLS_H
 #define RLS_H
 
+#include <utility>
 #include <vector>
 
 #include "Instance.h"
@@ -9,4 +10,8 @@
 bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance);
 bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instance);
 
+// Ranges of positions where reinserting job may improve s, taken from the blocks of its critical path. s must have
+// its departure times set
+std::vector<std::pair<size_t, size_t>> grabowski_reinsertion(const Instance &instance, const Solution &s, size_t job);
+
 #endif
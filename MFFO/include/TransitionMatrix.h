@@ -0,0 +1,25 @@
+#ifndef TRANSITION_MATRIX_H
+#define TRANSITION_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Instance.h"
+
+// n x n job-pair transition costs, computed once per instance. The entry (last, next) is the sum over the machines of
+// |p(next, j) - p(last, j + 1)|, the idle/blocking mismatch of the Ronconi expression when next is sequenced right
+// after last
+class TransitionMatrix {
+  public:
+    TransitionMatrix(const Instance &instance);
+
+    // Cost of sequencing next right after last
+    std::int32_t cost(size_t last, size_t next) const { return m_costs[last * m_num_jobs + next]; }
+
+  private:
+    size_t m_num_jobs = 0;
+    std::vector<std::int32_t> m_costs;
+};
+
+#endif
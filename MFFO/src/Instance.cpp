@@ -1,59 +1,220 @@
 #include "Instance.h"
 
 #include <algorithm>
-#include <cstdio>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
 #include <filesystem>
 #include <fstream>
-#include <iostream>
-#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Binary instance (written by instance_cache.py): header, per job processing times sums and the row-major matrix,
+// all in native byte order so the matrix can be used straight from the mapping
+constexpr char BINARY_MAGIC[8] = {'B', 'F', 'S', 'P', 'I', 'N', 'S', 'T'};
+constexpr uint32_t BINARY_VERSION = 1;
+
+struct BinaryHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t num_jobs;
+    uint64_t num_machines;
+    uint64_t checksum;
+};
+static_assert(sizeof(BinaryHeader) == 40, "the binary layout must not have padding");
+
+// FNV-1a over 64 bit words, the payload is always a multiple of 8 bytes
+uint64_t checksum(const unsigned char *data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool is_binary_instance(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+
+    char magic[sizeof(BINARY_MAGIC)] = {};
+    file.read(magic, sizeof(magic));
+
+    return file && std::memcmp(magic, BINARY_MAGIC, sizeof(magic)) == 0;
+}
+
+const char *skip_spaces(const char *current, const char *end) {
+    while (current != end && std::isspace(static_cast<unsigned char>(*current))) {
+        current++;
+    }
+    return current;
+}
+
+size_t parse_count(std::string_view line) {
+    const char *end = line.data() + line.size();
+
+    size_t count = 0;
+    auto [ptr, ec] = std::from_chars(skip_spaces(line.data(), end), end, count);
+    if (ec != std::errc()) {
+        throw std::runtime_error("Invalid instance header");
+    }
+
+    return count;
+}
+
+// Parses up to num_machines values into row and returns how many values the line has
+size_t parse_row(std::string_view line, long *row, size_t num_machines) {
+    const char *current = line.data();
+    const char *end = current + line.size();
+
+    size_t count = 0;
+    while ((current = skip_spaces(current, end)) != end) {
+        long value = 0;
+        auto [ptr, ec] = std::from_chars(current, end, value);
+        if (ec != std::errc()) {
+            break;
+        }
+
+        if (count < num_machines) {
+            row[count] = value;
+        }
+        count++;
+        current = ptr;
+    }
+
+    return count;
+}
+
+} // namespace
 
 Instance::Instance(const std::filesystem::path &path) {
 
-    std::ifstream file(path);
+    if (is_binary_instance(path)) {
+        // The sums used for LPT come precomputed
+        load_binary(path);
+    } else {
+        parse_text(path);
+        // Used for LPT
+        calculate_processing_times_sum();
+    }
+}
+
+void Instance::parse_text(const std::filesystem::path &path) {
+
+    std::ifstream file(path, std::ios::binary);
 
     if (!file) {
         throw std::runtime_error("Could not read file");
     }
 
-    std::string current_line;
-    getline(file, current_line);
-    m_num_jobs = std::stoull(current_line);
+    std::string buffer(std::filesystem::file_size(path), '\0');
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
-    getline(file, current_line);
-    m_num_machines = std::stoull(current_line);
+    const char *current = buffer.data();
+    const char *const end = current + buffer.size();
 
-    m_matrix.reserve(m_num_jobs);
-    while (getline(file, current_line)) {
+    auto next_line = [&current, end]() {
+        const char *line_end = std::find(current, end, '\n');
+        const std::string_view line(current, line_end - current);
+        current = line_end == end ? end : line_end + 1;
+        return line;
+    };
 
-        if (current_line.size() <= 1) {
-            continue;
-        }
+    m_num_jobs = parse_count(next_line());
+    m_num_machines = parse_count(next_line());
 
-        std::istringstream iss(current_line);
+    auto matrix = std::shared_ptr<long>(new long[m_num_jobs * m_num_machines], std::default_delete<long[]>());
 
-        size_t number = std::numeric_limits<size_t>::max();
+    size_t jobs_read = 0;
+    while (current != end) {
+        const std::string_view line = next_line();
 
-        std::vector<long> temporary;
-        temporary.reserve(m_num_machines);
+        if (line.size() <= 1) {
+            continue;
+        }
 
-        while (iss >> number) {
-            temporary.emplace_back(number);
+        if (jobs_read == m_num_jobs) {
+            throw std::runtime_error("Wrong number of jobs on instance");
         }
 
-        if (temporary.size() != m_num_machines) {
+        if (parse_row(line, matrix.get() + jobs_read * m_num_machines, m_num_machines) != m_num_machines) {
             throw std::runtime_error("Wrong number of machines on instance");
         }
-        m_matrix.emplace_back(std::move(temporary));
+        jobs_read++;
     }
 
-    if (m_matrix.size() != m_num_jobs || !file.eof()) {
+    if (jobs_read != m_num_jobs) {
         throw std::runtime_error("Wrong number of jobs on instance");
     }
 
-    // Used for LPT
-    calculate_processing_times_sum();
+    m_matrix = std::move(matrix);
+}
+
+void Instance::load_binary(const std::filesystem::path &path) {
+
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not read file");
+    }
+
+    struct stat status = {};
+    const bool has_size = fstat(fd, &status) == 0 && static_cast<size_t>(status.st_size) >= sizeof(BinaryHeader);
+    const size_t size = has_size ? static_cast<size_t>(status.st_size) : 0;
+    void *mapping = has_size ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Could not map binary instance");
+    }
+
+    // The matrix aliases this owner, so the mapping lives as long as any instance using it
+    const std::shared_ptr<const unsigned char> owner(static_cast<const unsigned char *>(mapping),
+                                                     [size](const unsigned char *ptr) {
+                                                         munmap(const_cast<unsigned char *>(ptr), size);
+                                                     });
+
+    BinaryHeader header;
+    std::memcpy(&header, owner.get(), sizeof(header));
+
+    if (header.version != BINARY_VERSION || header.element_size != sizeof(long)) {
+        throw std::runtime_error("Unsupported binary instance version");
+    }
+
+    // The header is untrusted, so bound both counts by the payload before multiplying them: each job takes its sum
+    // plus a row of the matrix, and none of the products below can wrap once a job fits in the file
+    const size_t payload = size - sizeof(header);
+    if (header.num_machines > payload / sizeof(long) ||
+        header.num_jobs > payload / (sizeof(uint64_t) + (header.num_machines * sizeof(long)))) {
+        throw std::runtime_error("Wrong size of binary instance");
+    }
+
+    const size_t sums_size = header.num_jobs * sizeof(uint64_t);
+    const size_t matrix_size = header.num_jobs * header.num_machines * sizeof(long);
+    if (size != sizeof(header) + sums_size + matrix_size) {
+        throw std::runtime_error("Wrong size of binary instance");
+    }
+
+    const unsigned char *data = owner.get() + sizeof(header);
+    if (checksum(data, sums_size + matrix_size) != header.checksum) {
+        throw std::runtime_error("Binary instance checksum mismatch");
+    }
+
+    m_num_jobs = header.num_jobs;
+    m_num_machines = header.num_machines;
+
+    const auto *sums = reinterpret_cast<const uint64_t *>(data);
+    m_processing_times_sum.assign(sums, sums + m_num_jobs);
+
+    m_matrix = std::shared_ptr<const long>(owner, reinterpret_cast<const long *>(data + sums_size));
 }
 
 void Instance::calculate_processing_times_sum() {
@@ -61,7 +222,7 @@ void Instance::calculate_processing_times_sum() {
     for (size_t i = 0; i < m_num_jobs; i++) {
         size_t sum = 0;
         for (size_t j = 0; j < m_num_machines; j++) {
-            sum += m_matrix[i][j];
+            sum += p(i, j);
         }
         m_processing_times_sum.push_back(sum);
     }
@@ -70,9 +231,14 @@ void Instance::calculate_processing_times_sum() {
 Instance Instance::create_reverse_instance() {
     Instance reverse = *this;
 
-    for (auto &line : reverse.m_matrix) {
-        std::reverse(line.begin(), line.end());
+    // The matrix is shared with this instance and may be a read-only mapping, so the reverse gets its own
+    auto matrix = std::shared_ptr<long>(new long[m_num_jobs * m_num_machines], std::default_delete<long[]>());
+    for (size_t i = 0; i < m_num_jobs; i++) {
+        for (size_t j = 0; j < m_num_machines; j++) {
+            matrix.get()[i * m_num_machines + j] = rp(i, j);
+        }
     }
+    reverse.m_matrix = std::move(matrix);
 
     return reverse;
 }
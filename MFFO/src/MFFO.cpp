@@ -7,6 +7,7 @@
 #include "RNG.h"
 #include "MinMax.h"
 #include "Solution.h"
+#include "Stats.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -53,29 +54,37 @@ Solution MFFO::solve() {
     // Smell-based search
     i = 0;
     while (true) {
+        STATS_COUNT(Iteration);
 
         Solution s1 = population[i]; 
-        s1 = MFFO::neighbourhood_search(s1);
+        {
+            STATS_TIME(Mutation);
+            s1 = MFFO::neighbourhood_search(s1);
 
-        core::recalculate_solution(m_instance, s1);
+            core::recalculate_solution(m_instance, s1);
+        }
 
         // Determine whether to apply RLS based on a probability
-        if (RNG::instance().generate_real_number(0.0, 1.0) < m_param.pls()) {
-            rls(s1, best.sequence, m_instance);
-        } 
-        // else {
-        core::recalculate_solution(m_instance, s1);
-        // }
+        {
+            STATS_TIME(LocalSearch);
+            if (RNG::instance().generate_real_number(0.0, 1.0) < m_param.pls()) {
+                rls(s1, best.sequence, m_instance);
+            } 
+            // else {
+            core::recalculate_solution(m_instance, s1);
+            // }
+        }
 
         if (!ro.empty() && uptime() >= ro.back() * mxn) {
             std::cout << best.cost << '\n';
             ro.pop_back();
         }
 
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best.cost, s1.cost))) {
             break;
         }
 
+        STATS_TIME(Selection);
         // Update population and best solution if s1 is better
         if (s1.cost < population[i].cost) {
             population[i] = s1;
@@ -104,6 +113,7 @@ Solution MFFO::solve() {
 }
 
 std::vector<Solution> MFFO::initialization() {
+    STATS_TIME(Initial);
     std::vector<Solution> population(m_param.ps());
     std::vector<size_t> individual(m_instance.num_jobs());
     std::iota(individual.begin(), individual.end(), 0);
@@ -117,7 +127,7 @@ std::vector<Solution> MFFO::initialization() {
 
         population[i].sequence = individual;
 
-        core::recalculate_solution(m_instance, population[i]);
+        core::calculate_cost(m_instance, population[i]);
     }
 
     return population;
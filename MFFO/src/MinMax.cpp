@@ -1,16 +1,17 @@
 #include "MinMax.h"
 #include "Core.h"
-#include <functional>
+#include "CandidateSet.h"
 
-MinMax::MinMax(Instance &instance, double alpha) : m_instance(instance), m_alpha(alpha) {}
+#include <limits>
+
+MinMax::MinMax(Instance &instance, double alpha) : m_instance(instance), m_alpha(alpha), m_transition(instance) {}
 
 Solution MinMax::solve() {
 
     std::vector<size_t> sequence;
+    sequence.reserve(m_instance.num_jobs());
 
-    const std::function<int(size_t, size_t)> p = [this](size_t i, size_t j) {
-        return m_instance.p(i, j); // Call m_instance.p through the lambda
-    };
+    auto p = [this](size_t i, size_t j) { return m_instance.p(i, j); };
     size_t first_node = 0;
 
     for (size_t i = 1; i < m_instance.num_jobs(); i++) {
@@ -37,29 +38,19 @@ Solution MinMax::solve() {
         }
     }
 
-    // Put the remaining nodes in a vector
-    std::vector<size_t> cl;
-    cl.reserve(m_instance.num_jobs());
+    // Put the remaining nodes in a candidate set
+    CandidateSet cl(m_instance.num_jobs());
     for (size_t i = 0; i < m_instance.num_jobs(); i++) {
         if (i != first_node && i != last_node) {
-            cl.push_back(i);
+            cl.insert(i);
         }
     }
 
     // Expression number 3 from Roconi paper, https://doi.org/10.1016/S0925-5273(03)00065-3
-    auto expression = [this, p](size_t c, size_t last) {
-        double lhs_value = 0;
-        double rhs_value = 0;
-
-        for (size_t j = 0; j < m_instance.num_machines() - 1; j++) {
-            lhs_value += (double)std::abs(p(c, j) - p(last, j + 1));
-        }
-        lhs_value *= m_alpha;
-
-        for (size_t j = 0; j < m_instance.num_machines(); j++) {
-            rhs_value += (double)p(c, j);
-        }
-        rhs_value *= 1 - m_alpha;
+    // the pairwise part comes precomputed from the transition matrix
+    auto expression = [this](size_t c, size_t last) {
+        const double lhs_value = m_alpha * (double)m_transition.cost(last, c);
+        const double rhs_value = (1 - m_alpha) * (double)m_instance.processing_times_sum()[c];
 
         return rhs_value + lhs_value;
     };
@@ -67,21 +58,22 @@ Solution MinMax::solve() {
     sequence.push_back(first_node);
     // Choose and insert best value node until there is no one left
     while (!cl.empty()) {
-        size_t best_node_index = 0;
+        size_t best_node = 0;
         double best_node_value = std::numeric_limits<double>::max();
         const size_t last_inserted = sequence.back();
 
-        for (size_t i = 0; i < cl.size(); i++) {
+        for (const size_t c : cl) {
 
-            const double value = expression(cl[i], last_inserted);
-            if (value < best_node_value) {
+            const double value = expression(c, last_inserted);
+            // The set is unordered, ties go to the smallest job as they would on a sorted list
+            if (value < best_node_value || (value == best_node_value && c < best_node)) {
                 best_node_value = value;
-                best_node_index = i;
+                best_node = c;
             }
         }
 
-        sequence.push_back(cl[best_node_index]);
-        cl.erase(cl.begin() + (long)best_node_index);
+        sequence.push_back(best_node);
+        cl.erase(best_node);
     }
 
     sequence.push_back(last_node);
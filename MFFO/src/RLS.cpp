@@ -2,6 +2,7 @@
 #include "Core.h"
 #include "Instance.h"
 #include "Solution.h"
+#include "Stats.h"
 #include "NEH.h"
 
 #include <cassert>
@@ -75,6 +76,7 @@ void handle_block_change(std::stack<GraphBlock> &blocks, GraphBlock &curr_block,
         curr_block.type = next_block_type;
     }
 }
+} // namespace
 
 std::vector<std::pair<size_t, size_t>> grabowski_reinsertion(const Instance &instance, const Solution &s,
                                                              const size_t job) {
@@ -138,9 +140,9 @@ std::vector<std::pair<size_t, size_t>> grabowski_reinsertion(const Instance &ins
 
     return {left, right};
 }
-} // namespace
 
 bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    STATS_COUNT(RlsCall);
     bool improved = false;
     size_t j = 0;
     size_t cnt = 0;
@@ -148,6 +150,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
     core::recalculate_solution(instance, s); // Set departure times matrix
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
 
@@ -167,6 +170,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
         if (makespan < s.cost) {
             s.sequence.insert(s.sequence.begin() + (long)best_index, job);
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             core::partial_recalculate_solution(instance, s, std::min(og_index, best_index));
@@ -182,6 +186,7 @@ bool rls_grabowski(Solution &s, const std::vector<size_t> &ref, Instance &instan
 }
 
 bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    STATS_COUNT(RlsCall);
 
     bool improved = false;
     size_t j = 0;
@@ -189,6 +194,7 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
     NEH helper(instance);
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
         for (size_t i = 0; i < s.sequence.size(); i++) {
@@ -202,6 +208,7 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
 
         if (makespan < s.cost) {
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             continue;
@@ -0,0 +1,35 @@
+#include "TransitionMatrix.h"
+
+#include <cstdlib>
+
+TransitionMatrix::TransitionMatrix(const Instance &instance)
+    : m_num_jobs(instance.num_jobs()), m_costs(m_num_jobs * m_num_jobs) {
+
+    const size_t n = instance.num_jobs();
+    const size_t width = instance.num_machines() - 1;
+
+    // Contiguous copies of the machines 0..m-2 (head) and 1..m-1 (tail) of every job, so each entry is a plain
+    // reduction over two arrays that the compiler can vectorize
+    std::vector<std::int32_t> heads(n * width);
+    std::vector<std::int32_t> tails(n * width);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < width; j++) {
+            heads[i * width + j] = static_cast<std::int32_t>(instance.p(i, j));
+            tails[i * width + j] = static_cast<std::int32_t>(instance.p(i, j + 1));
+        }
+    }
+
+    for (size_t last = 0; last < n; last++) {
+        const std::int32_t *tail = tails.data() + last * width;
+
+        for (size_t next = 0; next < n; next++) {
+            const std::int32_t *head = heads.data() + next * width;
+
+            std::int32_t sum = 0;
+            for (size_t j = 0; j < width; j++) {
+                sum += std::abs(head[j] - tail[j]);
+            }
+            m_costs[last * n + next] = sum;
+        }
+    }
+}
@@ -2,10 +2,12 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "Core.h"
 #include "Instance.h"
 #include "MFFO.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -21,9 +23,31 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"MFFO", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
+    const bool print_stats = params.stats();
+
     MFFO mffo(Instance(params.instance_path()), params);
 
     const Solution s = mffo.solve();
 
     std::cout << s.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(s.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 }
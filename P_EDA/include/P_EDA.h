@@ -27,9 +27,10 @@ class P_EDA { // NOLINT
     Solution probabilistic_model(const SizeTMatrix &p, const std::vector<SizeTMatrix> &t);
     std::vector<std::vector<size_t>> get_p();
     std::vector<SizeTMatrix> get_t();
-    std::vector<double> get_probability_vector(const std::vector<size_t> &sequence,
-                                               const std::vector<size_t> &unasigned_jobs, const SizeTMatrix &p,
-                                               const std::vector<SizeTMatrix> &t);
+    // Fills the first unasigned_jobs.size() elements of probabilities, one per unasigned job
+    void get_probability_vector(const std::vector<size_t> &sequence, const std::vector<size_t> &unasigned_jobs,
+                                const SizeTMatrix &p, const std::vector<SizeTMatrix> &t,
+                                std::vector<double> &probabilities);
 
     // Path relink
     Solution path_relink_swap(const Solution &alpha, const Solution &beta);
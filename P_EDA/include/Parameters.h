@@ -11,15 +11,23 @@ class Parameters {
 
     const std::string &instance_path() const { return m_instance_path; }
     bool verbose() const { return m_verbose; }
+    bool stats() const { return m_stats; }
     bool benchmark() const { return m_benchmark; }
     std::optional<size_t> seed() const { return m_seed; }
+    std::optional<size_t> evaluations() const { return m_evaluations; }
+    std::optional<size_t> target() const { return m_target; }
+    const std::optional<std::string> &trace() const { return m_trace; }
     size_t ro() const { return m_ro; }
 
   private:
     std::string m_instance_path;
     bool m_verbose = false;
+    bool m_stats = false;
     bool m_benchmark = false;
     std::optional<size_t> m_seed;
+    std::optional<size_t> m_evaluations;
+    std::optional<size_t> m_target;
+    std::optional<std::string> m_trace;
     size_t m_ro = 30;
 };
 
@@ -5,6 +5,7 @@
 #include "Parameters.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 #include "constructions/NEH.h"
 #include "constructions/PF.h"
 #include "local-search/RLS.h"
@@ -35,6 +36,7 @@ P_EDA::P_EDA(Instance &instance, Parameters &params, size_t ps, double lambda)
 }
 
 bool P_EDA::mrls(Solution &s, std::vector<size_t> &ref, Instance &instance) {
+    STATS_TIME(LocalSearch);
     bool improved = false;
     size_t n = instance.num_jobs();
     size_t j = 0;
@@ -110,6 +112,8 @@ Solution P_EDA::solve() {
     auto t = get_t();
 
     while (true) {
+        STATS_COUNT(Iteration);
+
         const Solution alpha = probabilistic_model(p, t);
 
         if (m_params.verbose()) {
@@ -146,16 +150,19 @@ Solution P_EDA::solve() {
         }
 
         //  Program should not accept any solution if the time is out
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best.cost, min_it->cost))) {
             break;
         }
 
-        const auto [found_in_population, max_cost_pos] = in_population_and_max_makespan(best.sequence);
-        const auto &max_cost = m_pc[max_cost_pos].cost;
+        {
+            STATS_TIME(Selection);
+            const auto [found_in_population, max_cost_pos] = in_population_and_max_makespan(best.sequence);
+            const auto &max_cost = m_pc[max_cost_pos].cost;
 
-        if (!found_in_population && best.cost < max_cost) {
-            m_pc.erase(m_pc.begin() + max_cost_pos);
-            m_pc.push_back(best);
+            if (!found_in_population && best.cost < max_cost) {
+                m_pc.erase(m_pc.begin() + max_cost_pos);
+                m_pc.push_back(best);
+            }
         }
 
         gen = (gen + 1) % m_ps;
@@ -219,12 +226,13 @@ void P_EDA::generate_random_individuals() {
         Solution s;
 
         s.sequence = random_sequence;
-        core::recalculate_solution(m_instance, s);
+        core::calculate_cost(m_instance, s);
         m_pc.push_back(s);
     }
 }
 
 void P_EDA::generate_initial_population() {
+    STATS_TIME(Initial);
     // this procedure will generate 0.1*PS pf-neh individuals, and the other 0.9*PS are randomly generated
     VERBOSE(m_params.verbose()) << "generating initial population...\n\n";
     const size_t n = m_instance.num_jobs();
@@ -259,7 +267,7 @@ void P_EDA::generate_initial_population() {
                       s.sequence.begin() +
                           (long)(n - lambda_pf_neh + 1)}; // needs to be n - lambda + 1 because [first_pos, last_post)
 
-        neh.second_step(std::move(candidate_jobs), s);
+        neh.second_step(candidate_jobs, s);
 
         m_pc.push_back(s);
 
@@ -272,6 +280,7 @@ void P_EDA::generate_initial_population() {
 }
 
 void P_EDA::modified_linear_rank_selection() {
+    STATS_TIME(Selection);
     // this procedure will generate another population (also with PS individuals)
     // based on the population we just generated.
     // First it will sort and rank the jobs based on lowest makespan, i.e.,
@@ -328,6 +337,7 @@ void P_EDA::modified_linear_rank_selection() {
 }
 
 Solution P_EDA::probabilistic_model(const SizeTMatrix &p, const std::vector<SizeTMatrix> &t) {
+    STATS_TIME(Construction);
     // in this probabilistic model, the objective is to get an individual that represents
     // accuratly the current population
 
@@ -337,30 +347,34 @@ Solution P_EDA::probabilistic_model(const SizeTMatrix &p, const std::vector<Size
     std::iota(unasigned_jobs.begin(), unasigned_jobs.end(), 0);
     std::vector<size_t> final_sequence;
     final_sequence.reserve(n);
+    // Reused for every position, only its first unasigned_jobs.size() elements are meaningful
+    std::vector<double> probabilities(n);
 
     while (final_sequence.size() < n - 1) {
         // this probability vector has the size of the unasigned jobs
         // each element of this vector represents the probability of adding the job in that position
         // to the current solution
-        auto probabilities = get_probability_vector(final_sequence, unasigned_jobs, p, t);
+        get_probability_vector(final_sequence, unasigned_jobs, p, t, probabilities);
 
         double roulette_wheel = 0;
 
-        size_t job_to_insert = unasigned_jobs[0];
+        size_t chosen = 0;
 
         // this roulette wheel works the same way as the sum of probabilities
         // in the modified linear rank selection
         const double r = RNG::instance().generate_real_number(0, 1);
 
+        // The intervals are contiguous and disjoint so the first one containing r is the only one
         for (size_t j = 0; j < unasigned_jobs.size(); j++) {
 
             if (roulette_wheel <= r && r < roulette_wheel + probabilities[j]) {
-                job_to_insert = unasigned_jobs[j];
+                chosen = j;
+                break;
             }
             roulette_wheel += probabilities[j];
         }
-        final_sequence.push_back(job_to_insert);
-        unasigned_jobs.erase(std::remove(unasigned_jobs.begin(), unasigned_jobs.end(), job_to_insert));
+        final_sequence.push_back(unasigned_jobs[chosen]);
+        unasigned_jobs.erase(unasigned_jobs.begin() + (long)chosen);
     }
     final_sequence.push_back(unasigned_jobs.front());
 
@@ -409,12 +423,9 @@ std::vector<SizeTMatrix> P_EDA::get_t() {
     return t;
 }
 
-std::vector<double> P_EDA::get_probability_vector(const std::vector<size_t> &sequence,
-                                                  const std::vector<size_t> &unasigned_jobs, const SizeTMatrix &p,
-                                                  const std::vector<SizeTMatrix> &t) {
-    const size_t n = m_instance.num_jobs();
-    std::vector<double> probabilities(unasigned_jobs.size());
-
+void P_EDA::get_probability_vector(const std::vector<size_t> &sequence, const std::vector<size_t> &unasigned_jobs,
+                                   const SizeTMatrix &p, const std::vector<SizeTMatrix> &t,
+                                   std::vector<double> &probabilities) {
     if (sequence.empty()) {
 
         double sum_p = 0;
@@ -422,7 +433,7 @@ std::vector<double> P_EDA::get_probability_vector(const std::vector<size_t> &seq
             sum_p += (double)p[0][j];
         }
 
-        for (size_t j = 0; j < n; j++) {
+        for (size_t j = 0; j < unasigned_jobs.size(); j++) {
             const size_t job = unasigned_jobs[j];
             probabilities[j] = (double)p[0][job] / sum_p;
         }
@@ -453,11 +464,10 @@ std::vector<double> P_EDA::get_probability_vector(const std::vector<size_t> &seq
             probabilities[j] /= 2;
         }
     }
-
-    return probabilities;
 }
 
 Solution P_EDA::path_relink_swap(const Solution &alpha, const Solution &beta) {
+    STATS_TIME(Crossover);
     Solution best;
     Solution current = alpha;
     const size_t n = m_instance.num_jobs();
@@ -633,7 +643,7 @@ void P_EDA::population_regen() {
         current_seq.erase(current_seq.begin() + pos);
         pos = RNG::instance().generate((size_t)0, current_seq.size());
         current_seq.insert(current_seq.begin() + pos, job);
-        core::recalculate_solution(m_instance, current_individual);
+        core::calculate_cost(m_instance, current_individual);
     }
     generate_random_individuals();
 }
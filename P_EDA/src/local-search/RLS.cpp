@@ -1,12 +1,14 @@
 #include "local-search/RLS.h"
 #include "Instance.h"
 #include "Solution.h"
+#include "Stats.h"
 #include "constructions/NEH.h"
 
 #include <cassert>
 #include <vector>
 
 bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
+    STATS_COUNT(RlsCall);
 
     bool improved = false;
     size_t j = 0;
@@ -14,6 +16,7 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
     NEH helper(instance);
     while (cnt < instance.num_jobs()) {
         j = (j + 1) % instance.num_jobs();
+        STATS_COUNT(RlsStep);
 
         const size_t job = ref[j];
         for (size_t i = 0; i < s.sequence.size(); i++) {
@@ -27,6 +30,7 @@ bool rls(Solution &s, const std::vector<size_t> &ref, Instance &instance) {
 
         if (makespan < s.cost) {
             cnt = 0;
+            STATS_COUNT(RlsImprovement);
             s.cost = makespan;
             improved = true;
             continue;
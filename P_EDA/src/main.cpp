@@ -1,11 +1,13 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "Core.h"
 #include "Instance.h"
 #include "P_EDA.h"
 #include "Parameters.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -23,9 +25,31 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"P_EDA", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
+    const bool print_stats = params.stats();
+
     P_EDA peda(instance, params, 50, 0.30);
     const Solution s_peda = peda.solve();
     std::cout << s_peda.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(s_peda.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 
     return 0;
 }
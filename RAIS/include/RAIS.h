@@ -17,7 +17,10 @@ public:
 
   void clone_antibodies(std::vector<Solution> &clones);
 
-  void mutation(Solution &antibody, bool recalculate);
+  void mutation(Solution &antibody);
+
+  // Random swap or insertion of two positions, returns the first one it changed
+  size_t random_move(std::vector<size_t> &sequence);
 
   bool nearby_antibody(Solution &s1, Solution &s2);
 
@@ -6,6 +6,8 @@
 #include <limits>
 #include <vector>
 
+#include "Stats.h"
+
 namespace {
 double uptime() {
   static const auto global_start_time = std::chrono::steady_clock::now();
@@ -41,6 +43,7 @@ RAIS::RAIS(Instance instance, Parameters params)
 }
 
 void RAIS::initialization() {
+  STATS_TIME(Initial);
 
   size_t n = m_instance.num_jobs();
   size_t npop = (m_params.nc() * (m_params.nc() + 1) / 2);
@@ -54,11 +57,13 @@ void RAIS::initialization() {
     std::shuffle(antibody.begin(), antibody.end(), RNG::instance().gen());
 
     m_pop[i].sequence = antibody;
-    core::recalculate_solution(m_instance, m_pop[i], m_departure_times);
+    m_pop[i].cost = core::calculate_makespan(m_instance, antibody);
+    m_pop[i].affinity = 1 / static_cast<double>(m_pop[i].cost);
   }
 }
 
 void RAIS::clone_antibodies(std::vector<Solution> &clones) {
+  STATS_TIME(Mutation);
 
   size_t k = 0;
   for (size_t i = 0; i < m_params.nc(); i++) {
@@ -66,14 +71,21 @@ void RAIS::clone_antibodies(std::vector<Solution> &clones) {
     core::recalculate_solution(m_instance, m_pop[i], m_departure_times);
     for (size_t j = 0; j < m_params.nc() - i; j++) {
       clones[k] = m_pop[i];
-      mutation(clones[k], false);
+      mutation(clones[k]);
       k++;
     }
   }
 
 }
 
-void RAIS::mutation(Solution &antibody, bool recalculate) {
+void RAIS::mutation(Solution &antibody) {
+
+  // The departure times were recalculated for the antibody this clone was copied from
+  const size_t first = random_move(antibody.sequence);
+  core::partial_recalculate_solution(m_instance, antibody, m_departure_times, m_auxiliar_matrix, first);
+}
+
+size_t RAIS::random_move(std::vector<size_t> &sequence) {
 
   size_t n = m_instance.num_jobs();
 
@@ -88,28 +100,23 @@ void RAIS::mutation(Solution &antibody, bool recalculate) {
   // Swap
   if (RNG::instance().generate_real_number(0.0, 1.0) > 0.5) {
 
-    std::swap(antibody.sequence[i], antibody.sequence[j]);
+    std::swap(sequence[i], sequence[j]);
 
   }
   // Insertion
   else {
     if (i < j) {
-      std::rotate(antibody.sequence.begin() + i,
-                  antibody.sequence.begin() + j,
-                  antibody.sequence.begin() + j + 1);
+      std::rotate(sequence.begin() + i,
+                  sequence.begin() + j,
+                  sequence.begin() + j + 1);
     } else {
-      std::rotate(antibody.sequence.begin() + j,
-                  antibody.sequence.begin() + j+1,
-                  antibody.sequence.begin() + i);
+      std::rotate(sequence.begin() + j,
+                  sequence.begin() + j+1,
+                  sequence.begin() + i);
     }
   }
 
-  if (recalculate) {
-    core::partial_recalculate_solution(m_instance, antibody, m_departure_times, m_auxiliar_matrix, 0);
-  } else {
-    core::partial_recalculate_solution(m_instance, antibody, m_departure_times, m_auxiliar_matrix, std::min(i, j));
-  }
-  
+  return std::min(i, j);
 }
 
 bool RAIS::nearby_antibody(Solution &s1, Solution &s2) {
@@ -129,6 +136,7 @@ bool RAIS::nearby_antibody(Solution &s1, Solution &s2) {
 }
 
 void RAIS::supression() {
+  STATS_TIME(Selection);
 
   size_t i = 0;
   size_t j = m_pop.size() - 1;
@@ -155,11 +163,17 @@ void RAIS::supression() {
 }
 
 void RAIS::SA() {
+  STATS_TIME(LocalSearch);
 
   for (size_t a = 0; a < m_pop.size(); a++) {
 
     Solution cp = m_pop[a];
-    mutation(cp, true);
+    random_move(cp.sequence);
+
+    // The matrices hold the departure times of whatever was recalculated last, not of m_pop[a], so the neighbour is
+    // evaluated from scratch and only its cost is kept
+    cp.cost = core::calculate_makespan(m_instance, cp.sequence);
+    cp.affinity = 1 / static_cast<double>(cp.cost);
 
     if (cp.cost <= m_pop[a].cost) {
       m_pop[a] = cp;
@@ -174,6 +188,7 @@ void RAIS::SA() {
 }
 
 void RAIS::select_nc_best() {
+  STATS_TIME(Selection);
   std::vector<Solution> aux(m_params.nc());
 
   for (size_t i = 0; i < m_params.nc(); i++) {
@@ -217,6 +232,7 @@ Solution RAIS::solve() {
   select_nc_best();
 
   while (true) {
+    STATS_COUNT(Iteration);
 
     clone_antibodies(clones); // cloning the best antibodies
 
@@ -232,7 +248,7 @@ Solution RAIS::solve() {
       ro.pop_back();
     }
 
-    if (uptime() > m_time_limit) {
+    if (core::should_stop(uptime() > m_time_limit, std::min(best_solution.cost, m_pop[0].cost))) {
       break;
     }
 
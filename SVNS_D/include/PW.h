@@ -3,28 +3,31 @@
 
 #include "Instance.h"
 #include "Solution.h"
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 class PW {
   public:
     PW(Instance &instance);
 
-    std::vector<double> calculate_avg_processing_time(size_t candidate_job, std::vector<size_t> &unscheduled);
-    void update_avg_processing_time(size_t previous_job, size_t next_job, size_t qt_unscheduled,
-                                    std::vector<double> &artificial_processing_times);
-    std::vector<double> calculate_artificial_departure_time(std::vector<std::vector<size_t>> &d,
-                                                            std::vector<double> &artificial_processing_times);
-
-    // chi is basically the sigma for the artificial job
-    double calculate_chi(std::vector<size_t> &new_departure_time, std::vector<double> &artificial_departure_time,
-                         std::vector<double> &artificial_processing_times);
-    double calculate_f(std::vector<std::vector<size_t>> &d, std::vector<size_t> &new_departure_time, double chi,
-                       size_t job, size_t k);
-
     Solution solve();
 
   private:
     Instance &m_instance;
+
+    // Departure times of the last scheduled job, all zeros before the first one
+    std::vector<size_t> m_departure_time;
+    // Departure times the job being scored would have if appended
+    std::vector<size_t> m_candidate_departure_time;
+    // Processing times of the unscheduled jobs summed per machine, the artificial job is their average without the
+    // candidate
+    std::vector<size_t> m_unscheduled_sum;
+
+    void calculate_candidate_departure_time(size_t job);
+
+    // f of appending job at step k and chi (basically the sigma for the artificial job), which breaks ties
+    std::pair<double, double> score(size_t job, size_t k, size_t num_unscheduled);
 };
 
 #endif
@@ -3,6 +3,7 @@
 #include "Log.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 #include "NEH.h"
 #include "PW.h"
@@ -26,6 +27,7 @@ size_t uptime() {
 SVNS_D::SVNS_D(Instance &instance, Parameters &params) : m_instance(instance), m_params(params) {}
 
 Solution SVNS_D::PW_PWE2() {
+    STATS_TIME(Initial);
     Solution solution;
 
     PW pw(m_instance);
@@ -59,6 +61,7 @@ Solution SVNS_D::PW_PWE2() {
 }
 
 bool SVNS_D::LS1_D_swap(Solution &solution, std::vector<size_t> &reference) { // NOLINT
+    STATS_TIME(LocalSearch);
     size_t original_cost = solution.cost;
 
     for (size_t i = 0; i < solution.sequence.size() - 1; i++) {
@@ -94,12 +97,15 @@ bool SVNS_D::LS1_D_swap(Solution &solution, std::vector<size_t> &reference) { //
 }
 
 bool SVNS_D::LS2_D_insertion(Solution &solution, std::vector<size_t> &reference) { // NOLINT
+    STATS_TIME(LocalSearch);
+    STATS_COUNT(RlsCall);
     size_t original_cost = solution.cost;
 
     NEH helper(m_instance);
     
     for(size_t j = 0; j < reference.size(); j++) {
         const size_t job = reference[j];
+        STATS_COUNT(RlsStep);
 
         for (size_t i = 0; i < solution.sequence.size(); i++) {
             if (solution.sequence[i] == job) {
@@ -112,6 +118,7 @@ bool SVNS_D::LS2_D_insertion(Solution &solution, std::vector<size_t> &reference)
         solution.sequence.insert(solution.sequence.begin() + (long)best_index, job);
 
         if (makespan < solution.cost) {
+            STATS_COUNT(RlsImprovement);
             solution.cost = makespan;
         }
     }
@@ -130,6 +137,7 @@ void SVNS_D::apply_insertion(Solution &solution, const long from, const long to)
 }
 
 void SVNS_D::pertubation(Solution &solution) {
+    STATS_TIME(Shaking);
     std::vector<size_t> removed_jobs(m_params.d());
     for (size_t i = 0; i < m_params.d(); ++i) {
         auto job_to_remove = RNG::instance().generate<size_t>(0, solution.sequence.size() - 1);
@@ -171,6 +179,8 @@ Solution SVNS_D::solve() {
     std::vector<size_t> reference(m_instance.num_jobs());
     std::iota(reference.begin(), reference.end(), 0);
     while (true) {
+        STATS_COUNT(Iteration);
+
         size_t counter = 0;
         size_t local_search_type = 0;
 
@@ -187,7 +197,7 @@ Solution SVNS_D::solve() {
             size_t original_cost = current.cost;
 
             if (local_search_type == 0) {
-                while (uptime() <= time_limit) {
+                while (!core::should_stop(uptime() > time_limit, std::min(best.cost, candidate.cost))) {
                     std::shuffle(reference.begin(), reference.end(), RNG::instance().gen());
 
                     if (not LS1_D_swap(candidate, reference)) {
@@ -195,7 +205,7 @@ Solution SVNS_D::solve() {
                     }
                 }
             } else {
-                while (uptime() <= time_limit) {
+                while (!core::should_stop(uptime() > time_limit, std::min(best.cost, candidate.cost))) {
                     std::shuffle(reference.begin(), reference.end(), RNG::instance().gen());
 
                     if (not LS2_D_insertion(candidate, reference)) {
@@ -227,7 +237,7 @@ Solution SVNS_D::solve() {
         if (current.cost < best.cost) {
             best = current;
         }
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, best.cost)) {
             VERBOSE(m_params.verbose()) << "Time limit reached!\n";
             break;
         }
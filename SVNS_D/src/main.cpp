@@ -1,10 +1,12 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "Core.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
 #include "SVNS_D.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -14,8 +16,30 @@ int main(int argc, char *argv[]) {
     if (auto seed = params.seed()) {
         RNG::instance().set_seed(*seed);
     }
+
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"SVNS_D", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+    const bool print_stats = params.stats();
+
     SVNS_D svns_d(instance, params);
 
     Solution solution_svns_d = svns_d.solve();
     std::cout << solution_svns_d.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(solution_svns_d.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 }
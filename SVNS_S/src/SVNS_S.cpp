@@ -3,6 +3,7 @@
 #include "Log.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 
 #include "constructions/NEH.h"
 #include "constructions/PW.h"
@@ -27,6 +28,7 @@ double uptime() {
 SVNS_S::SVNS_S(Instance &instance, Parameters &params) : m_instance(instance), m_params(params) {}
 
 Solution SVNS_S::PW_PWE2() {
+    STATS_TIME(Initial);
     Solution solution;
 
     PW pw(m_instance);
@@ -61,6 +63,7 @@ Solution SVNS_S::PW_PWE2() {
 }
 
 bool SVNS_S::LS1_S_swap(Solution &solution, std::vector<size_t> &reference) { // NOLINT
+    STATS_TIME(LocalSearch);
     size_t original_cost = solution.cost;
 
     for (size_t i = 0; i < solution.sequence.size() - 1; i++) {
@@ -92,12 +95,15 @@ bool SVNS_S::LS1_S_swap(Solution &solution, std::vector<size_t> &reference) { //
 }
 
 bool SVNS_S::LS2_S_insertion(Solution &solution, std::vector<size_t> &reference) { // NOLINT
+    STATS_TIME(LocalSearch);
+    STATS_COUNT(RlsCall);
     size_t original_cost = solution.cost;
 
     NEH helper(m_instance);
     
     for(size_t j = 0; j < reference.size(); j++) {
         const size_t job = reference[j];
+        STATS_COUNT(RlsStep);
 
         for (size_t i = 0; i < solution.sequence.size(); i++) {
             if (solution.sequence[i] == job) {
@@ -109,6 +115,7 @@ bool SVNS_S::LS2_S_insertion(Solution &solution, std::vector<size_t> &reference)
         solution.sequence.insert(solution.sequence.begin() + (long)best_index, job);
 
         if (makespan < solution.cost) {
+            STATS_COUNT(RlsImprovement);
             solution.cost = makespan;
         }
     }
@@ -127,6 +134,7 @@ void SVNS_S::apply_insertion(Solution &solution, const long from, const long to)
 }
 
 void SVNS_S::pertubation(Solution &solution) {
+    STATS_TIME(Shaking);
     std::vector<size_t> removed_jobs(m_params.d());
     for (size_t i = 0; i < m_params.d(); ++i) {
         auto job_to_remove = RNG::instance().generate<size_t>(0, solution.sequence.size() - 1);
@@ -167,6 +175,8 @@ Solution SVNS_S::solve() {
     VERBOSE(m_params.verbose()) << "Time limit: " << time_limit/1000 << " seconds\n";
 
     while (true) {
+        STATS_COUNT(Iteration);
+
         size_t counter = 0;
         size_t local_search_type = 0;
 
@@ -217,7 +227,7 @@ Solution SVNS_S::solve() {
             ro.pop_back();
         }
             
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best.cost, current.cost))) {
             break;
         }
 
@@ -233,7 +243,7 @@ Solution SVNS_S::solve() {
         if (current.cost < best.cost) {
             best = current;
         }
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, best.cost)) {
             VERBOSE(m_params.verbose()) << "Time limit reached!\n";
             break;
         }
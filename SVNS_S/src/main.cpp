@@ -3,10 +3,12 @@
 #include <iostream>
 #include <numeric>
 
+#include "Core.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
 #include "SVNS_S.h"
+#include "Stats.h"
 #include "constructions/GRASP.h"
 #include "constructions/LPT.h"
 #include "constructions/MinMax.h"
@@ -19,6 +21,22 @@
 int main(int argc, char *argv[]) {
 
     Parameters params(argc, argv);
+
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"SVNS_S", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
+    const bool print_stats = params.stats();
+
     Instance instance(params.instance_path());
 
     SVNS_S svns_s(instance, params);
@@ -26,4 +44,11 @@ int main(int argc, char *argv[]) {
     Solution solution_svns_s = svns_s.solve();
 
     std::cout << solution_svns_s.cost << '\n';
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(solution_svns_s.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 }
@@ -12,6 +12,7 @@
 #include "RLS.h"
 #include "SaDIWO.h"
 #include "Solution.h"
+#include "Stats.h"
 
 static const double EPSILON = std::numeric_limits<double>::min();
 
@@ -102,21 +103,13 @@ std::vector<size_t> SaDIWO::sort_inc_proc_time() {
 }
 
 Population SaDIWO::population_init() {
+    STATS_TIME(Initial);
     const auto init_seq = sort_inc_proc_time();
 
-    Solution best;
-
     // PF-NEH
-    const int x = 5;
-    for (size_t k = 0; k < x; ++k) {
-        PF_NEH pf_neh(m_instance);
-        const size_t lambda = m_instance.num_jobs() >= 25 ? 25 : m_instance.num_jobs();
-        const auto sol = pf_neh.solve(lambda);
-
-        if (sol.cost < best.cost) {
-            best = sol;
-        }
-    }
+    const size_t lambda = m_instance.num_jobs() >= 25 ? 25 : m_instance.num_jobs();
+    PF_NEH pf_neh(m_instance);
+    Solution best = pf_neh.solve(lambda);
 
     // Calling it to set the departure times
     core::recalculate_solution(m_instance, best);
@@ -158,12 +151,18 @@ size_t SaDIWO::get_solution_d(const Population &pop, const size_t solution_cost)
 }
 
 Population SaDIWO::spatial_dispersal(const Population &pop) {
+    STATS_TIME(Construction);
     Population new_pop;
     new_pop.solutions.clear();
     NEH helper(m_instance);
     for (size_t i = 0; i < pop.solutions.size(); ++i) {
         const auto &sol = pop.solutions[i];
         for (size_t j = 0; j < static_cast<size_t>(pop.seeds[i]); ++j) {
+            // A generation is long, so the budget is also checked for every seed and not only in solve()
+            if (core::budget_spent()) {
+                return new_pop;
+            }
+
             const size_t d = get_solution_d(pop, sol.cost);
 
             Solution sol_copy;
@@ -179,7 +178,7 @@ Population SaDIWO::spatial_dispersal(const Population &pop) {
             }
 
             core::recalculate_solution(m_instance, sol_copy);
-            helper.second_step(std::move(pi_r), sol_copy);
+            helper.second_step(pi_r, sol_copy);
             new_pop.add_solution(std::move(sol_copy));
         }
     }
@@ -188,12 +187,16 @@ Population SaDIWO::spatial_dispersal(const Population &pop) {
 }
 
 void SaDIWO::local_search(Population &pop) {
+    STATS_TIME(LocalSearch);
     for (size_t i = 0; i < pop.solutions.size(); i++) {
         if (RNG::instance().generate_real_number(0.0, 1.0) < m_params.pls()) {
             continue;
         }
         std::vector<size_t> ref = pop.solutions[pop.best_solution_idx].sequence;
         for (size_t j = 0; j < 3; j++) {
+            if (core::budget_spent()) {
+                return;
+            }
             rls_grabowski(pop.solutions[i], ref, m_instance);
             // Update best solution if it's found by rls
             if (pop.solutions[i].cost < pop.solutions[pop.best_solution_idx].cost) {
@@ -205,6 +208,7 @@ void SaDIWO::local_search(Population &pop) {
 }
 
 Population SaDIWO::competitive_exclusion(Population pop, Population new_pop) const {
+    STATS_TIME(Selection);
     Population competitive_pop;
 
     pop.solutions.reserve(pop.solutions.size() + new_pop.solutions.size());
@@ -246,10 +250,12 @@ Solution SaDIWO::solve() {
             ro.pop_back();
         }
 
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, pop.solutions[pop.best_solution_idx].cost)) {
             break;
         }
 
+        STATS_COUNT(Iteration);
+
         best = pop.solutions[pop.best_solution_idx];
 
         pop.calculate_seeds(m_params);
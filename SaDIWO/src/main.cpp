@@ -2,11 +2,13 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "Core.h"
 #include "Instance.h"
 #include "Log.h"
 #include "Parameters.h"
 #include "RNG.h"
 #include "SaDIWO.h"
+#include "Stats.h"
 
 int main(int argc, char *argv[]) {
 
@@ -15,10 +17,33 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"SaDIWO", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
     try {
+        const bool print_stats = params.stats();
+
         Instance instance(params.instance_path());
         SaDIWO sadiwo(std::move(instance), std::move(params));
-        std::cout << sadiwo.solve().cost << "\n";
+        const Solution best = sadiwo.solve();
+        std::cout << best.cost << "\n";
+        core::report_evaluations(std::cerr);
+        core::report_target(std::cerr);
+        core::write_trace(best.cost);
+
+        if (print_stats) {
+            stats::print(std::cerr);
+        }
     } catch (std::runtime_error &err) {
         std::cerr << err.what() << '\n';
         exit(EXIT_FAILURE);
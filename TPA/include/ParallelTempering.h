@@ -0,0 +1,46 @@
+#ifndef PARALLEL_TEMPERING_H
+#define PARALLEL_TEMPERING_H
+
+#include "Instance.h"
+#include "Parameters.h"
+#include "Solution.h"
+#include "constructions/NEH.h"
+
+#include <random>
+#include <vector>
+
+// Copies of the simulated annealing chain, one per thread, each kept at a fixed temperature of a geometric ladder
+// between the initial temperature and --ft. Neighbouring temperatures trade their solutions every few steps, so the
+// hot replicas keep exploring while the cold ones refine, instead of depending on a single decay schedule
+class ParallelTempering {
+  public:
+    ParallelTempering(Solution &solution, Instance &instance, Parameters &params);
+    Solution solve();
+
+  private:
+    struct Replica {
+        Replica(const Solution &solution, Instance &instance, double temperature, size_t seed);
+
+        double temperature;
+        std::mt19937 gen;
+        NEH helper; // Insertion buffers of this replica
+        Solution current;
+        Solution candidate;
+        Solution best;
+    };
+
+    Solution &m_solution;
+    Instance &m_instance;
+    Parameters &m_params;
+
+    double m_initial_temp;
+
+    // Moves a random job to its best other position, accepted with the same criterion as SimulatedAnnealing
+    void step(Replica &replica);
+
+    // Swaps the solutions of the pairs (first, first + 1), (first + 2, first + 3), ... with probability
+    // min(1, exp((1/T_i - 1/T_j) * (C_i - C_j))), alternating first keeps every pair trading
+    void exchange(std::vector<Replica> &replicas, size_t first);
+};
+
+#endif
@@ -11,24 +11,36 @@ class Parameters {
 
     const std::string &instance_path() const { return m_instance_path; }
     bool verbose() const { return m_verbose; }
+    bool stats() const { return m_stats; }
     std::optional<size_t> seed() const { return m_seed; }
+    std::optional<size_t> evaluations() const { return m_evaluations; }
+    std::optional<size_t> target() const { return m_target; }
+    const std::optional<std::string> &trace() const { return m_trace; }
     bool benchmark() const { return m_benchmark; }
     std::optional<size_t> tl() const { return m_tl; }
     size_t ro() const { return m_ro; }
     size_t n_iter() const { return m_n_iter; }
     double final_temperature() const { return m_final_temperature; }
     double alpha() const { return m_alpha; }
+    size_t replicas() const { return m_replicas; }
+    size_t exchange_interval() const { return m_exchange_interval; }
 
   private:
     std::string m_instance_path;
     bool m_verbose = false;
+    bool m_stats = false;
     bool m_benchmark = false;
     std::optional<size_t> m_seed;
+    std::optional<size_t> m_evaluations;
+    std::optional<size_t> m_target;
+    std::optional<std::string> m_trace;
     std::optional<size_t> m_tl;
     size_t m_ro = 100;
     size_t m_n_iter = 1800000;
     double m_final_temperature = 1;
     double m_alpha = 0.8;
+    size_t m_replicas = 1;
+    size_t m_exchange_interval = 1000;
 };
 
 #endif
@@ -4,6 +4,7 @@
 #include "Instance.h"
 #include "Solution.h"
 #include "Parameters.h"
+#include "constructions/NEH.h"
 
 #include <iostream>
 
@@ -23,6 +24,8 @@ class SimulatedAnnealing {
     double m_initial_temp;
     double m_decay;
 
+    NEH m_helper; // Reused by every anneal step
+
     void calculate_initial_temp();
     void calculate_decay();
     Solution anneal(Solution &current_solution, size_t position);
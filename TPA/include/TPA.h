@@ -4,6 +4,7 @@
 #include "Instance.h"
 #include "Solution.h"
 #include "Parameters.h"
+#include "ParallelTempering.h"
 #include "SimulatedAnnealing.h"
 
 #include <iostream>
@@ -0,0 +1,146 @@
+#include "ParallelTempering.h"
+
+#include "Core.h"
+#include "Instance.h"
+#include "Parallel.h"
+#include "RNG.h"
+#include "Solution.h"
+#include "Stats.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+namespace {
+size_t uptime() {
+    static const auto global_start_time = std::chrono::steady_clock::now();
+    auto now = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - global_start_time);
+    return duration.count();
+}
+} // namespace
+
+ParallelTempering::Replica::Replica(const Solution &solution, Instance &instance, double temperature, size_t seed)
+    : temperature(temperature), gen(seed), helper(instance) {
+    // Only the sequence and the cost are kept, the insertion rebuilds the matrices it needs from the sequence
+    current.sequence = solution.sequence;
+    current.cost = solution.cost;
+    candidate = current;
+    best = current;
+}
+
+ParallelTempering::ParallelTempering(Solution &solution, Instance &instance, Parameters &params)
+    : m_solution(solution), m_instance(instance), m_params(params), m_initial_temp(0) {
+    // Same initial temperature as SimulatedAnnealing
+    size_t sum = 0;
+    for (size_t i = 0; i < m_instance.num_jobs(); i++) {
+        for (size_t j = 0; j < m_instance.num_machines(); j++) {
+            sum += m_instance.p(i, j);
+        }
+    }
+
+    m_initial_temp = (double)sum / (double)(5 * m_instance.num_jobs() * m_instance.num_machines());
+}
+
+Solution ParallelTempering::solve() {
+
+    size_t time_limit = 0;
+    const size_t mxn = m_instance.num_jobs() * m_instance.num_machines();
+    if (auto tl = m_params.tl()) {
+        time_limit = *tl;
+    } else {
+        time_limit = (m_params.ro() * mxn) / 1000;
+    }
+
+    std::vector<size_t> ro;
+    if (m_params.benchmark()) {
+        time_limit = (100 * mxn) / 1000;
+        ro = {90, 60, 30};
+    }
+
+    // Replica 0 is the hottest, the seeds are drawn in order so a run only depends on the seed and the replica count
+    const size_t num_replicas = m_params.replicas();
+    const double ratio = m_params.final_temperature() / m_initial_temp;
+    std::vector<Replica> replicas;
+    replicas.reserve(num_replicas);
+    for (size_t r = 0; r < num_replicas; r++) {
+        const double temperature = m_initial_temp * std::pow(ratio, (double)r / (double)(num_replicas - 1));
+        replicas.emplace_back(m_solution, m_instance, temperature, RNG::instance().gen()());
+    }
+
+    Solution best = replicas.front().best;
+    WorkerPool pool(num_replicas);
+
+    for (size_t round = 0;; round++) {
+        pool.run([this, &replicas](size_t w) {
+            for (size_t i = 0; i < m_params.exchange_interval(); i++) {
+                step(replicas[w]);
+            }
+        });
+
+        for (const Replica &replica : replicas) {
+            if (replica.best.cost < best.cost) {
+                best = replica.best;
+            }
+        }
+
+        if (!ro.empty() && uptime() >= (ro.back() * mxn) / 1000) {
+
+            std::cout << best.cost << '\n';
+            ro.pop_back();
+        }
+        // Only checked between rounds, so the replicas may go over an evaluation budget by up to one round
+        if (core::should_stop(uptime() > time_limit, best.cost)) {
+            break;
+        }
+
+        exchange(replicas, round % 2);
+    }
+
+    return best;
+}
+
+void ParallelTempering::step(Replica &replica) {
+    STATS_COUNT(Iteration);
+    std::uniform_int_distribution<size_t> position_dis(0, m_instance.num_jobs() - 1);
+    const size_t position = position_dis(replica.gen);
+
+    Solution &candidate = replica.candidate;
+    const size_t job = replica.current.sequence[position];
+    candidate.sequence = replica.current.sequence;
+    candidate.sequence.erase(candidate.sequence.begin() + (long)position);
+
+    auto [best_index, makespan] = replica.helper.mtaillard_best_insertion(candidate.sequence, job, position);
+
+    candidate.sequence.insert(candidate.sequence.begin() + (long)best_index, job);
+    candidate.cost = makespan;
+
+    const double delta = (double)candidate.cost - (double)replica.current.cost;
+    if (delta > 0) {
+        std::uniform_real_distribution<double> random_dis(0, 1);
+        if (std::exp(-delta / replica.temperature) <= random_dis(replica.gen)) {
+            return;
+        }
+    }
+
+    // The cost from the insertion is exact, there is nothing to recalculate
+    std::swap(replica.current, candidate);
+    if (replica.current.cost < replica.best.cost) {
+        replica.best = replica.current;
+    }
+}
+
+void ParallelTempering::exchange(std::vector<Replica> &replicas, size_t first) {
+    STATS_TIME(Acceptance);
+    for (size_t i = first; i + 1 < replicas.size(); i += 2) {
+        Replica &hot = replicas[i];
+        Replica &cold = replicas[i + 1];
+
+        const double log_probability = ((1 / hot.temperature) - (1 / cold.temperature)) *
+                                       ((double)hot.current.cost - (double)cold.current.cost);
+        if (log_probability >= 0 || std::exp(log_probability) > RNG::instance().generate_real_number(0, 1)) {
+            std::swap(hot.current, cold.current);
+        }
+    }
+}
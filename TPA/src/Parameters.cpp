@@ -1,6 +1,10 @@
 #include "Parameters.h"
 
+#include "Core.h"
 #include "argparse/argparse.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
 
 namespace {
 void config_argparse(argparse::ArgumentParser &cli) {
@@ -9,6 +13,28 @@ void config_argparse(argparse::ArgumentParser &cli) {
 
     cli.add_argument("-s", "--seed").help("set random number generator seed").metavar("SEED").scan<'i', size_t>();
 
+    cli.add_argument("--evaluations")
+        .help("stop once this many makespan evaluations are spent instead of on the time limit, the step running "
+              "then finishes first so the count reported at the end may be a bit higher")
+        .metavar("EVALUATIONS")
+        .scan<'i', size_t>();
+    cli.add_argument("--target")
+        .help("stop as soon as a solution with at most this makespan is found")
+        .metavar("MAKESPAN")
+        .scan<'i', size_t>();
+    cli.add_argument("--trace")
+        .help("write every improvement of the best solution to this file, as JSON if it ends in .json or CSV")
+        .metavar("PATH");
+    cli.add_argument("--print-isa")
+        .help("print the instruction set the hot kernels were dispatched to and exit")
+        .action([](const std::string &) {
+            std::cout << core::selected_isa() << '\n';
+            std::exit(0);
+        })
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
     cli.add_argument("-v", "--verbose").help("set program verbosity").metavar("VERBOSE").default_value(false).flag();
 
     cli.add_argument("-b", "--benchmark")
@@ -17,6 +43,11 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .default_value(false)
         .flag();
 
+    cli.add_argument("--stats")
+        .help("print the hot-path counters and phase times to stderr at exit")
+        .default_value(false)
+        .flag();
+
     cli.add_argument("-t", "--time")
         .help("set the time limit for the program")
         .metavar("TIME_LIMIT")
@@ -46,6 +77,19 @@ void config_argparse(argparse::ArgumentParser &cli) {
         .metavar("ALPHA")
         .default_value(0.8)
         .scan<'f', double>();
+
+    cli.add_argument("--replicas")
+        .help("number of parallel tempering replicas, one thread each on a ladder of temperatures from the initial "
+              "one down to --ft, 1 runs the single simulated annealing chain")
+        .metavar("REPLICAS")
+        .default_value(size_t(1))
+        .scan<'i', size_t>();
+
+    cli.add_argument("--exchange")
+        .help("number of steps every replica runs between two rounds of solution exchanges")
+        .metavar("STEPS")
+        .default_value(size_t(1000))
+        .scan<'i', size_t>();
 }
 } // namespace
 
@@ -67,10 +111,16 @@ Parameters::Parameters(int argc, char **argv) {
     // Set members
     m_instance_path = cli.get<std::string>("instance");
     m_verbose = cli.get<bool>("--verbose");
+    m_stats = cli.get<bool>("--stats");
     m_seed = cli.present<size_t>("--seed");
+    m_evaluations = cli.present<size_t>("--evaluations");
+    m_target = cli.present<size_t>("--target");
+    m_trace = cli.present<std::string>("--trace");
     m_benchmark = cli.get<bool>("--benchmark");
     m_ro = cli.get<size_t>("--ro");
     m_n_iter = cli.get<size_t>("--iter");
     m_final_temperature = cli.get<double>("--ft");
     m_alpha = cli.get<double>("--alpha");
+    m_replicas = std::max<size_t>(1, cli.get<size_t>("--replicas"));
+    m_exchange_interval = std::max<size_t>(1, cli.get<size_t>("--exchange"));
 }
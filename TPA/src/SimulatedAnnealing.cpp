@@ -5,6 +5,7 @@
 #include "Instance.h"
 #include "RNG.h"
 #include "Solution.h"
+#include "Stats.h"
 #include <chrono>
 #include <cassert>
 #include <cmath>
@@ -22,7 +23,7 @@ size_t uptime() {
 
 SimulatedAnnealing::SimulatedAnnealing(Solution &solution, Instance &instance, Parameters &params)
     : m_solution(solution), m_instance(instance),  m_params(params), m_n_iter(m_params.n_iter()), m_final_temp(m_params.final_temperature()), 
-    m_initial_temp(0), m_decay(0) {
+    m_initial_temp(0), m_decay(0), m_helper(instance) {
     calculate_initial_temp();
     calculate_decay();
 }
@@ -62,6 +63,8 @@ Solution SimulatedAnnealing::solve() {
     Solution current_solution = m_solution;
 
     while (true) {
+        STATS_COUNT(Iteration);
+
         auto position = RNG::instance().generate<size_t>(0, n_jobs - 1);
         Solution new_sol = anneal(current_solution, position);
 
@@ -73,10 +76,11 @@ Solution SimulatedAnnealing::solve() {
             ro.pop_back();
         }
         //  Program should not accept any solution if the time is out
-        if (uptime() > time_limit) {
+        if (core::should_stop(uptime() > time_limit, std::min(best_cost, new_sol.cost))) {
             break;
         }
-        
+
+        STATS_TIME(Acceptance);
         if (delta <= 0) {
             current_solution.sequence = new_sol.sequence;
             core::recalculate_solution(m_instance, current_solution);
@@ -121,13 +125,12 @@ void SimulatedAnnealing::calculate_decay() {
 }
 
 Solution SimulatedAnnealing::anneal(Solution &current_solution, size_t position) {
-    NEH helper(m_instance);
-
+    STATS_TIME(LocalSearch);
     Solution new_sol = current_solution;
     size_t job = current_solution.sequence[position];
     new_sol.sequence.erase(new_sol.sequence.begin() + position);
 
-    auto [best_index, makespan] = helper.mtaillard_best_insertion(new_sol.sequence, job, position);
+    auto [best_index, makespan] = m_helper.mtaillard_best_insertion(new_sol.sequence, job, position);
 
     new_sol.sequence.insert(new_sol.sequence.begin() + best_index, job);
     new_sol.cost = makespan;
@@ -3,14 +3,24 @@
 
 #include "Instance.h"
 #include "Solution.h"
+#include "Stats.h"
 
 TPA::TPA(Instance &instance, Parameters &params) : instance(instance), params(params) {}
 
 Solution TPA::solve() {
     // 1st step: modified NEH
-    Solution s_neh = MNEH::solve(params.alpha(), instance);
+    Solution s_neh;
+    {
+        STATS_TIME(Initial);
+        s_neh = MNEH::solve(params.alpha(), instance);
+    }
+
+    // 2nd step: simulated annealing, or parallel tempering when there is more than one replica
+    if (params.replicas() > 1) {
+        ParallelTempering pt(s_neh, instance, params);
+        return pt.solve();
+    }
 
-    // 2nd step: simulated annealing
     SimulatedAnnealing sa(s_neh, instance, params);
     Solution best = sa.solve();
 
@@ -3,9 +3,17 @@
 #include "Core.h"
 #include "Instance.h"
 #include "Solution.h"
+#include "Stats.h"
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <utility>
+#include <vector>
+
+namespace {
+// Below this many departure time cells a best insertion is too short to pay for waking the shared pool
+constexpr size_t PARALLEL_INSERTION_CELLS = 1 << 16;
+} // namespace
 
 NEH::NEH(Instance &instance) : m_instance(instance) {
 
@@ -21,11 +29,12 @@ Solution NEH::solve(std::vector<size_t> phi) {
     phi.erase(phi.begin());
 
 
-    second_step(std::move(phi), s);
+    second_step(phi, s);
     return s;
 }
 
 size_t NEH::insert_calculation(const size_t i, const size_t k, const size_t best_value) {
+    STATS_COUNT(InsertCalculation);
     size_t max_value = 0;
     size_t old = 0;
 
@@ -43,6 +52,7 @@ size_t NEH::insert_calculation(const size_t i, const size_t k, const size_t best
     set_old_and_max(i, 0, value);
 
     if (max_value >= best_value) {
+        STATS_COUNT(InsertEarlyExit);
         return max_value;
     }
 
@@ -51,6 +61,7 @@ size_t NEH::insert_calculation(const size_t i, const size_t k, const size_t best
         set_old_and_max(i, j, value);
 
         if (max_value >= best_value) {
+            STATS_COUNT(InsertEarlyExit);
             return max_value;
         }
     }
@@ -61,11 +72,28 @@ size_t NEH::insert_calculation(const size_t i, const size_t k, const size_t best
     return max_value;
 }
 
-std::pair<size_t, size_t> NEH::taillard_best_insertion(const std::vector<size_t> &s, size_t k) {
+BFSP_KERNEL std::pair<size_t, size_t> NEH::taillard_best_insertion(const std::vector<size_t> &s, size_t k) {
+    core::count_evaluations(s.size() + 1);
+    STATS_COUNT(BestInsertion);
     m_inner.sequence = s;
 
-    core::calculate_departure_times(m_instance, m_inner);
-    core::calculate_tail(m_instance, m_inner);
+    // Large insertions borrow the shared pool, unless some other one already holds it
+    SharedPoolLease lease(s.size() * m_instance.num_machines() >= PARALLEL_INSERTION_CELLS);
+    WorkerPool *pool = lease.get();
+
+    if (pool != nullptr) {
+        // The departure times and the tails are independent recurrences
+        pool->run(2, [this](size_t w) {
+            if (w == 0) {
+                core::calculate_departure_times(m_instance, m_inner);
+            } else {
+                core::calculate_tail(m_instance, m_inner);
+            }
+        });
+    } else {
+        core::calculate_departure_times(m_instance, m_inner);
+        core::calculate_tail(m_instance, m_inner);
+    }
 
     auto &q = m_inner.tail;
 
@@ -87,6 +115,10 @@ std::pair<size_t, size_t> NEH::taillard_best_insertion(const std::vector<size_t>
     size_t best_index = 0;
     size_t best_value = max_value;
 
+    if (pool != nullptr) {
+        return parallel_insertion_scan(*pool, k, s.size(), best_value);
+    }
+
     for (size_t i = 1; i <= s.size(); i++) {
         max_value = insert_calculation(i, k, best_value);
 
@@ -99,7 +131,41 @@ std::pair<size_t, size_t> NEH::taillard_best_insertion(const std::vector<size_t>
     return {best_index, best_value};
 }
 
-std::pair<size_t, size_t> NEH::mtaillard_best_insertion(const std::vector<size_t> &s, size_t k, size_t original_position) {
+std::pair<size_t, size_t> NEH::parallel_insertion_scan(WorkerPool &pool, size_t k, size_t size, size_t best_value) {
+    // Each worker scans one contiguous range of positions, sharing the best makespan for the early exits. Positions
+    // that tie the shared best are still evaluated in full, so the lowest one wins exactly as in the serial scan
+    std::atomic<size_t> shared_best{best_value};
+    std::vector<std::pair<size_t, size_t>> found(pool.size(), {0, best_value});
+
+    pool.run([&](size_t w) {
+        auto &[best_index, value] = found[w];
+        const size_t last = 1 + ((w + 1) * size / pool.size());
+
+        for (size_t i = 1 + (w * size / pool.size()); i < last; i++) {
+            const size_t bound = std::min(value, shared_best.load(std::memory_order_relaxed) + 1);
+            const size_t max_value = insert_calculation(i, k, bound);
+
+            if (max_value < bound) {
+                value = max_value;
+                best_index = i;
+                atomic_min(shared_best, max_value);
+            }
+        }
+    });
+
+    std::pair<size_t, size_t> best = {0, best_value};
+    for (const auto &candidate : found) {
+        if (candidate.second < best.second) {
+            best = candidate;
+        }
+    }
+
+    return best;
+}
+
+BFSP_KERNEL std::pair<size_t, size_t> NEH::mtaillard_best_insertion(const std::vector<size_t> &s, size_t k,
+                                                                     size_t original_position) {
+    core::count_evaluations(s.size());
     m_inner.sequence = s;
 
     core::calculate_departure_times(m_instance, m_inner);
@@ -161,14 +227,12 @@ std::pair<size_t, size_t> NEH::mtaillard_best_insertion(const std::vector<size_t
     return {best_index, best_value};
 }
 
-void NEH::second_step(std::vector<size_t> phi, Solution &s) {
+void NEH::second_step(const std::vector<size_t> &phi, Solution &s) {
 
-    while (!phi.empty()) {
-        auto [best_index, makespan] = taillard_best_insertion(s.sequence, phi.front());
+    for (const size_t job : phi) {
+        auto [best_index, makespan] = taillard_best_insertion(s.sequence, job);
 
-        s.sequence.insert(s.sequence.begin() + (long)best_index, phi.front());
+        s.sequence.insert(s.sequence.begin() + (long)best_index, job);
         s.cost = makespan;
-
-        phi.erase(phi.begin());
     }
 }
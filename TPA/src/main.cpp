@@ -3,9 +3,11 @@
 #include <iostream>
 #include <numeric>
 
+#include "Core.h"
 #include "Instance.h"
 #include "Parameters.h"
 #include "RNG.h"
+#include "Stats.h"
 #include "TPA.h"
 
 int main(int argc, char *argv[]) {
@@ -17,7 +19,29 @@ int main(int argc, char *argv[]) {
         RNG::instance().set_seed(*seed);
     }
 
+    if (auto budget = params.evaluations()) {
+        core::set_evaluation_budget(*budget);
+    }
+
+    if (auto target = params.target()) {
+        core::set_target(*target);
+    }
+
+    if (const auto &trace = params.trace()) {
+        core::enable_trace(*trace, {"TPA", params.instance_path(), RNG::instance().seed(),
+                                    std::vector<std::string>(argv, argv + argc)});
+    }
+
+    const bool print_stats = params.stats();
+
     TPA tpa(instance, params);
     Solution s_tpa = tpa.solve();
     std::cout << s_tpa.cost << std::endl;
+    core::report_evaluations(std::cerr);
+    core::report_target(std::cerr);
+    core::write_trace(s_tpa.cost);
+
+    if (print_stats) {
+        stats::print(std::cerr);
+    }
 }
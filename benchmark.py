@@ -11,7 +11,9 @@ def process_iteration(binary_path, instance_name, instance_size, iteration):
     os.makedirs(os.path.dirname(destination_base), exist_ok=True)
 
     with open(destination_base, "w") as f:
-        subprocess.run([f"./{binary_path}", "-b", f"instances/{instance_size}/{instance_name}"], stdout=f)
+        # The trace lets trace_arpd.py compute ARPD at any time point without rerunning with other ro values
+        subprocess.run([f"./{binary_path}", "-b", f"instances/{instance_size}/{instance_name}",
+                        "--trace", destination_base.replace(".txt", ".csv")], stdout=f)
 
     return destination_base
 
@@ -27,6 +29,10 @@ def main(binary_path, num_threads):
 
     instances = [(size, f) for size in instances_sizes for f in listdir(f"instances/{size}/")]
     instances.sort()
+    # The runs already take one core each, so the binaries must not add their own insertion threads on top
+    if num_threads > 1:
+        os.environ.setdefault("BFSP_INSERTION_THREADS", "1")
+
     with ThreadPoolExecutor(max_workers=num_threads) as executor:
         futures = [executor.submit(process_iteration, binary_path, instance, size, i) for (size, instance) in instances for i in range(num_runs)]
         counter = 0
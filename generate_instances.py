@@ -0,0 +1,38 @@
+import os
+import sys
+
+from instance_cache import write_binary
+
+# Taillard's generator (Benchmarks for basic scheduling problems, 1993): processing times uniform in [1, 99] drawn
+# machine by machine from a Lehmer LCG, so a (jobs, machines, seed) triple always gives the same instance. With the
+# time seeds from the paper it reproduces the original instances, e.g. 20 5 873654221 is J20M5N1
+
+def unif(seed, low, high):
+    # Schrage's method for seed * 16807 mod (2^31 - 1) without overflow
+    m, a, b, c = 2147483647, 16807, 127773, 2836
+    k = seed // b
+    seed = a * (seed % b) - k * c
+    if seed < 0:
+        seed += m
+    return seed, low + int(seed / m * (high - low + 1))
+
+def generate(num_jobs, num_machines, seed):
+    rows = [[0] * num_machines for _ in range(num_jobs)]
+    for j in range(num_machines):
+        for i in range(num_jobs):
+            seed, rows[i][j] = unif(seed, 1, 99)
+    return rows
+
+def write_text(rows, destination):
+    os.makedirs(os.path.dirname(destination) or ".", exist_ok=True)
+    with open(destination, "w") as f:
+        f.write(f"{len(rows)}\n{len(rows[0])}\n")
+        for row in rows:
+            f.write(" ".join(str(value) for value in row) + "\n")
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (5, 6) or (len(sys.argv) == 6 and sys.argv[5] != "--binary"):
+        print(f"run with: python {sys.argv[0]} num_jobs num_machines seed /path/to/output [--binary]")
+        exit(1)
+    rows = generate(int(sys.argv[1]), int(sys.argv[2]), int(sys.argv[3]))
+    (write_binary if len(sys.argv) == 6 else write_text)(rows, sys.argv[4])
@@ -38,7 +38,8 @@ class hmgHS {
     // create a new harmony using the other ones as inspiration
     void improvise_new_harmony(Solution &s);
 
-    // This function deals with job with the same value on the harmony
+    // This function deals with job with the same value on the harmony, s.sequence must be the harmony_to_permutation
+    // of s.harmony
     void revision(Solution &s);
 
     // rebuilds the harmony from the job permutation generated by RLS
@@ -57,6 +58,8 @@ class hmgHS {
     std::vector<Solution> m_pop;
     std::vector<double> m_min;
     std::vector<double> m_max;
+    // Scratch for revision, swapped with the harmony it sorts
+    std::vector<double> m_sorted_harmony;
 };
 
 #endif
\ No newline at end of file
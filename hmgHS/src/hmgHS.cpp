@@ -5,6 +5,8 @@
 #include <iostream>
 #include <limits>
 
+#include "Stats.h"
+
 namespace {
 size_t uptime() {
     static const auto global_start_time = std::chrono::steady_clock::now();
@@ -39,6 +41,7 @@ void hmgHS::check_minmax(Solution &s) {
 }
 
 void hmgHS::generate_initial_pop() {
+    STATS_TIME(Initial);
     m_pop = std::vector<Solution>(m_params.ms());
     Solution s;
     s.harmony = std::vector<double>(m_instance.num_jobs(), 0.0);
@@ -161,6 +164,7 @@ std::pair<double, double> hmgHS::get_min_max_of_position(size_t j) {
 }
 
 void hmgHS::improvise_new_harmony(Solution &sol) {
+    STATS_TIME(Crossover);
 
     size_t n = m_instance.num_jobs();
 
@@ -198,7 +202,13 @@ void hmgHS::improvise_new_harmony(Solution &sol) {
 void hmgHS::revision(Solution &s) {
     size_t n = m_instance.num_jobs();
 
-    std::sort(s.harmony.begin(), s.harmony.end(), [](double a, double b) { return a > b; });
+    // The sequence is the harmony's indices sorted by decreasing value, so reading the harmony through it gives the
+    // values sorted without a second sort
+    m_sorted_harmony.resize(n);
+    for (size_t j = 0; j < n; j++) {
+        m_sorted_harmony[j] = s.harmony[s.sequence[j]];
+    }
+    s.harmony.swap(m_sorted_harmony);
 
     for (size_t j = 0; j < n - 1; j++) {
         if (s.harmony[j] == s.harmony[j + 1]) {
@@ -236,6 +246,7 @@ void hmgHS::sort_permutation(Solution &s) {
 }
 
 void hmgHS::update(Solution &s) {
+    STATS_TIME(Selection);
     size_t i = m_params.ms() - 1;
     while (s.cost < m_pop[i].cost) {
         i--;
@@ -248,8 +259,9 @@ void hmgHS::update(Solution &s) {
 
     if (i < m_params.ms()) {
         sort_permutation(s);
-        m_pop.insert(m_pop.begin() + i, s);
-        m_pop.pop_back();
+        // Copied over the worst harmony to reuse its buffers, the rotation only swaps vector handles
+        m_pop.back() = s;
+        std::rotate(m_pop.begin() + (long)i, m_pop.end() - 1, m_pop.end());
     }
 }
 
@@ -275,16 +287,20 @@ Solution hmgHS::solve() {
     new_solution.harmony = std::vector<double>(m_instance.num_jobs());
     new_solution.sequence = std::vector<size_t>(m_instance.num_jobs());
     while (true) {
-        
+        STATS_COUNT(Iteration);
+
         improvise_new_harmony(new_solution);
 
         harmony_to_permutation(new_solution);
         
         revision(new_solution);
 
-        std::shuffle(ref.begin(), ref.end(), RNG::instance().gen());
-        rls(new_solution, ref, m_instance);
-        core::recalculate_solution(m_instance, new_solution);
+        {
+            STATS_TIME(LocalSearch);
+            std::shuffle(ref.begin(), ref.end(), RNG::instance().gen());
+            rls(new_solution, ref, m_instance);
+            core::recalculate_solution(m_instance, new_solution);
+        }
         
         update(new_solution);
 
@@ -294,7 +310,7 @@ Solution hmgHS::solve() {
             ro.pop_back();
         }
 
-        if (uptime() > m_time_limit) {
+        if (core::should_stop(uptime() > m_time_limit, std::min(best_solution.cost, m_pop[0].cost))) {
             break;
         }
 
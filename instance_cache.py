@@ -0,0 +1,54 @@
+import os
+import struct
+import sys
+
+# Converts text instances to the binary format Instance memory-maps: a 40 byte header (magic, version, element size,
+# jobs, machines, checksum), the per job processing times sums and the row-major matrix, all as 64 bit little endian
+
+MAGIC = b"BFSPINST"
+VERSION = 1
+MASK = (1 << 64) - 1
+
+def checksum(payload):
+    # FNV-1a over 64 bit words, same as Instance.cpp
+    hash = 14695981039346656037
+    for (word,) in struct.iter_unpack("<Q", payload):
+        hash = ((hash ^ word) * 1099511628211) & MASK
+    return hash
+
+def convert(source, destination):
+    with open(source) as f:
+        lines = f.read().split("\n")
+
+    num_jobs, num_machines = int(lines[0]), int(lines[1])
+    rows = [[int(value) for value in line.split()] for line in lines[2:] if len(line) > 1]
+
+    if len(rows) != num_jobs or any(len(row) != num_machines for row in rows):
+        raise ValueError(f"{source} does not match its header")
+
+    write_binary(rows, destination)
+
+def write_binary(rows, destination):
+    num_jobs, num_machines = len(rows), len(rows[0])
+
+    payload = struct.pack(f"<{num_jobs}Q", *(sum(row) for row in rows))
+    payload += struct.pack(f"<{num_jobs * num_machines}q", *(value for row in rows for value in row))
+
+    os.makedirs(os.path.dirname(destination) or ".", exist_ok=True)
+    with open(destination, "wb") as f:
+        f.write(MAGIC + struct.pack("<IIQQQ", VERSION, 8, num_jobs, num_machines, checksum(payload)) + payload)
+
+def main(source_dir, destination_dir):
+    counter = 0
+    for root, _, files in os.walk(source_dir):
+        for file in sorted(files):
+            relative = os.path.relpath(os.path.join(root, file), source_dir)
+            convert(os.path.join(source_dir, relative), os.path.join(destination_dir, relative))
+            counter += 1
+    print(f"Converted {counter} instances to {destination_dir}")
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(f"run with: python {sys.argv[0]} instances/ instances_bin/")
+        exit(1)
+    main(sys.argv[1], sys.argv[2])
@@ -0,0 +1,92 @@
+import argparse
+import os
+import re
+import subprocess
+import tempfile
+import time
+
+from generate_instances import generate, write_text
+
+# Scaling benchmark beyond Taillard's sizes: generates one instance per (jobs, machines) pair and runs every binary
+# with a fixed evaluation budget, and optionally MFFO's kernels_bench, recording time, throughput and peak memory
+
+EVALUATIONS_REGEX = re.compile(r"evaluations: (\d+) in [0-9.e+-]+s \(([0-9.e+-]+)/s\)")
+KERNEL_REGEX = re.compile(r"^\s+(\S+)\s+([0-9.]+)\s+([0-9]+)\s+(\S+)$")
+
+def main(args):
+    destination = args.output
+    os.makedirs(os.path.dirname(destination) or ".", exist_ok=True)
+
+    with tempfile.TemporaryDirectory() as directory, open(destination, "w") as results:
+        results.write("binary,jobs,machines,kernel,seconds,calls_per_second,evaluations_per_second,max_rss_kb,status\n")
+
+        for num_jobs in args.jobs:
+            for num_machines in args.machines:
+                instance_path = os.path.join(directory, f"J{num_jobs}M{num_machines}")
+                write_text(generate(num_jobs, num_machines, args.seed), instance_path)
+
+                for binary in args.binaries:
+                    command = [binary, instance_path, "--seed", "1", "--evaluations", str(args.evaluations)]
+                    _, stderr, elapsed, usage, status = run_with_usage(command, args.timeout)
+                    match = EVALUATIONS_REGEX.search(stderr)
+                    rate = match.group(2) if match else ""
+
+                    results.write(f"{os.path.basename(binary)},{num_jobs},{num_machines},,{elapsed:.6f},,{rate},"
+                                  f"{usage.ru_maxrss},{status}\n")
+                    print(f"{os.path.basename(binary)} J{num_jobs}M{num_machines}: {elapsed:.2f}s,"
+                          f" {rate} evaluations/s, {usage.ru_maxrss} KB, {status}")
+
+                if args.kernels:
+                    stdout, _, elapsed, usage, status = run_with_usage([args.kernels, instance_path], args.timeout)
+                    for line in stdout.split("\n"):
+                        match = KERNEL_REGEX.match(line)
+                        if match and match.group(1) != "kernel":
+                            name, ns, calls, evals = match.groups()
+                            evals = "" if evals == "-" else evals
+                            results.write(f"{os.path.basename(args.kernels)},{num_jobs},{num_machines},{name},"
+                                          f"{float(ns) * 1e-9:.9f},{calls},{evals},{usage.ru_maxrss},{status}\n")
+                    print(f"{os.path.basename(args.kernels)} J{num_jobs}M{num_machines}: {elapsed:.2f}s,"
+                          f" {usage.ru_maxrss} KB, {status}")
+
+                results.flush()
+
+    print(f"Written to {destination}")
+
+def run_with_usage(command, timeout):
+    # wait4 gives the peak RSS of this child alone, RUSAGE_CHILDREN would give the max over every run so far
+    # Linux keeps the peak of the forked copy of this script across exec, so small runs read as at least its size
+    with tempfile.TemporaryFile("w+") as stdout, tempfile.TemporaryFile("w+") as stderr:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=stdout, stderr=stderr, text=True)
+
+        timed_out = False
+        while True:
+            pid, exit_status, usage = os.wait4(process.pid, os.WNOHANG)
+            if pid != 0:
+                break
+            if time.perf_counter() - start > timeout:
+                process.kill()
+                _, exit_status, usage = os.wait4(process.pid, 0)
+                timed_out = True
+                break
+            time.sleep(0.01)
+        # Keeps Popen from waiting on the pid that was already reaped
+        process.returncode = 0
+
+        elapsed = time.perf_counter() - start
+        stdout.seek(0)
+        stderr.seek(0)
+        status = "timeout" if timed_out else ("ok" if os.waitstatus_to_exitcode(exit_status) == 0 else "error")
+        return stdout.read(), stderr.read(), elapsed, usage, status
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("binaries", nargs="+", help="solver binaries, all must accept --evaluations")
+    parser.add_argument("--jobs", type=lambda s: [int(v) for v in s.split(",")], default=[500, 1000, 2000, 5000, 10000])
+    parser.add_argument("--machines", type=lambda s: [int(v) for v in s.split(",")], default=[20, 60])
+    parser.add_argument("--seed", type=int, default=873654221, help="generator seed, the same for every size")
+    parser.add_argument("--evaluations", type=int, default=100000, help="evaluation budget of each solver run")
+    parser.add_argument("--kernels", help="path to MFFO's kernels_bench to also time the kernels at every size")
+    parser.add_argument("--timeout", type=float, default=600, help="seconds before a run is killed")
+    parser.add_argument("--output", default="scaling/scaling.csv")
+    main(parser.parse_args())
@@ -0,0 +1,49 @@
+import csv
+import json
+import os
+import sys
+
+# ARPD at arbitrary time points from the --trace files benchmark.py leaves next to each result
+
+results_dir = "results"
+
+def cost_at(trace_path, time_ns):
+    with open(trace_path) as f:
+        rows = csv.DictReader(line for line in f if not line.startswith("#"))
+        cost = None
+        for row in rows:
+            if int(row["time_ns"]) > time_ns:
+                break
+            cost = int(row["cost"])
+    return cost
+
+def main(time_points):
+    with open('best_ribas.json') as f:
+        taillard_best_solutions = json.load(f)
+
+    for jxmy_dir in sorted(os.listdir(results_dir)):
+        jxmy_path = os.path.join(results_dir, jxmy_dir)
+        if not os.path.isdir(jxmy_path) or jxmy_dir not in taillard_best_solutions:
+            continue
+
+        arpd = [[] for _ in time_points]
+        for instance_dir in os.listdir(jxmy_path):
+            instance_path = os.path.join(jxmy_path, instance_dir)
+            best_value = taillard_best_solutions[jxmy_dir][int(instance_dir[instance_dir.find("N")+1:]) - 1]
+
+            for file in os.listdir(instance_path):
+                if not file.endswith(".csv"):
+                    continue
+                for i, seconds in enumerate(time_points):
+                    cost = cost_at(os.path.join(instance_path, file), seconds * 1e9)
+                    # Runs without any solution yet at that time are left out instead of skewing the mean
+                    if cost is not None:
+                        arpd[i].append((cost - best_value) / best_value * 100)
+
+        print(f"{jxmy_dir} = {[round(sum(values) / len(values), 2) if values else None for values in arpd]}")
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print(f"run with: python {sys.argv[0]} seconds [seconds...]")
+        exit(1)
+    main([float(t) for t in sys.argv[1:]])
@@ -0,0 +1,62 @@
+import json
+import os.path
+import re
+import subprocess
+import sys
+from concurrent.futures import ThreadPoolExecutor, as_completed
+
+# Time-to-target: run a binary with --target set to best known (best_ribas.json) plus a percentage and collect how long
+# each seed took to reach it, sorted so the empirical distribution can be plotted directly
+
+TARGET_REGEX = re.compile(r"target \d+ reached in ([0-9.]+)s")
+
+def process_seed(binary_path, instance_path, target, seed, extra_args):
+    command = [f"./{binary_path}", instance_path, "--seed", str(seed), "--target", str(target), *extra_args]
+
+    result = subprocess.run(command, capture_output=True, text=True)
+    match = TARGET_REGEX.search(result.stderr)
+
+    return seed, float(match.group(1)) if match else None
+
+def main(binary_path, instance_size, instance_number, percentage, num_seeds, num_threads, extra_args):
+    with open("best_ribas.json") as f:
+        best_known = json.load(f)[instance_size][instance_number - 1]
+
+    target = int(best_known * (1 + percentage / 100))
+    instance_name = f"{instance_size}N{instance_number}"
+    instance_path = f"instances/{instance_size}/{instance_name}"
+
+    # The runs already take one core each, so the binaries must not add their own insertion threads on top
+    if num_threads > 1:
+        os.environ.setdefault("BFSP_INSERTION_THREADS", "1")
+
+    times = []
+    with ThreadPoolExecutor(max_workers=num_threads) as executor:
+        futures = [executor.submit(process_seed, binary_path, instance_path, target, seed, extra_args)
+                   for seed in range(1, num_seeds + 1)]
+        for future in as_completed(futures):
+            seed, elapsed = future.result()
+            print(f"Seed {seed}: {'not reached' if elapsed is None else f'{elapsed:.6f}s'}")
+            times.append((elapsed, seed))
+
+    reached = sorted(t for t in times if t[0] is not None)
+
+    destination = f"ttt/{os.path.basename(binary_path)}/{instance_name}_{percentage:g}.csv"
+    os.makedirs(os.path.dirname(destination), exist_ok=True)
+
+    # Probability column is the usual (i - 0.5) / n plotting position, runs that missed the target still count in n
+    with open(destination, "w") as f:
+        f.write("seed,time,probability\n")
+        for i, (elapsed, seed) in enumerate(reached, start=1):
+            f.write(f"{seed},{elapsed:.6f},{(i - 0.5) / num_seeds:.6f}\n")
+
+    print(f"Target {target} (best known {best_known} + {percentage:g}%) reached by {len(reached)} out of {num_seeds}")
+    print(f"Written to {destination}")
+
+if __name__ == "__main__":
+    if len(sys.argv) < 7:
+        print(f"run with: python {sys.argv[0]} /path/to/binary J50M10 instance_number percentage num_seeds num_threads"
+              " [binary arguments...]")
+        exit(1)
+    # Trailing arguments go to the binary as is, e.g. a larger time limit so that harder targets can be reached
+    main(sys.argv[1], sys.argv[2], int(sys.argv[3]), float(sys.argv[4]), int(sys.argv[5]), int(sys.argv[6]), sys.argv[7:])